@@ -70,6 +70,7 @@ project "netlist"
 		MAME_DIR .. "src/lib/netlist/analog/nld_opamps.h",
 		MAME_DIR .. "src/lib/netlist/solver/nld_solver.cpp",
 		MAME_DIR .. "src/lib/netlist/solver/nld_solver.h",
+		MAME_DIR .. "src/lib/netlist/solver/nld_static_solvers.cpp",
 		MAME_DIR .. "src/lib/netlist/solver/nld_matrix_solver.h",
 		MAME_DIR .. "src/lib/netlist/solver/nld_ms_direct.h",
 		MAME_DIR .. "src/lib/netlist/solver/nld_ms_direct1.h",
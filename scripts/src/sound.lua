@@ -479,6 +479,7 @@ if (SOUNDS["K054539"]~=null) then
 	files {
 		MAME_DIR .. "src/devices/sound/k054539.cpp",
 		MAME_DIR .. "src/devices/sound/k054539.h",
+		MAME_DIR .. "src/devices/sound/pcmmix.h",
 	}
 end
 
@@ -592,6 +593,7 @@ if (SOUNDS["C352"]~=null) then
 	files {
 		MAME_DIR .. "src/devices/sound/c352.cpp",
 		MAME_DIR .. "src/devices/sound/c352.h",
+		MAME_DIR .. "src/devices/sound/pcmmix.h",
 	}
 end
 
@@ -741,6 +743,7 @@ if (SOUNDS["QSOUND"]~=null) then
 	files {
 		MAME_DIR .. "src/devices/sound/qsound.cpp",
 		MAME_DIR .. "src/devices/sound/qsound.h",
+		MAME_DIR .. "src/devices/sound/pcmmix.h",
 		MAME_DIR .. "src/devices/cpu/dsp16/dsp16.cpp",
 		MAME_DIR .. "src/devices/cpu/dsp16/dsp16.h",
 		MAME_DIR .. "src/devices/cpu/dsp16/dsp16dis.cpp",
@@ -790,6 +793,7 @@ if (SOUNDS["MULTIPCM"]~=null) then
 	files {
 		MAME_DIR .. "src/devices/sound/multipcm.cpp",
 		MAME_DIR .. "src/devices/sound/multipcm.h",
+		MAME_DIR .. "src/devices/sound/pcmmix.h",
 	}
 end
 
@@ -71,6 +71,7 @@ project("mametests")
 		MAME_DIR .. "3rdparty/googletest/googletest/include",
 		MAME_DIR .. "src/osd",
 		MAME_DIR .. "src/emu",
+		MAME_DIR .. "src/devices",
 		MAME_DIR .. "src/lib/util",
 		ext_includedir("expat"),
 		ext_includedir("zlib"),
@@ -79,6 +80,19 @@ project("mametests")
 	files {
 		MAME_DIR .. "tests/main.cpp",
 		MAME_DIR .. "tests/lib/util/corestr.cpp",
+		MAME_DIR .. "tests/lib/util/palette.cpp",
 		MAME_DIR .. "tests/emu/attotime.cpp",
+		MAME_DIR .. "tests/emu/drawgfx.cpp",
+		MAME_DIR .. "tests/emu/rendersw.cpp",
+		MAME_DIR .. "tests/emu/rgbwide.cpp",
+		MAME_DIR .. "tests/emu/tilemap.cpp",
+		MAME_DIR .. "tests/devices/sound/pcmmix.cpp",
+		MAME_DIR .. "tests/devices/sound/ym2151mix.cpp",
+		MAME_DIR .. "tests/devices/video/stvvdp1fill.cpp",
+		MAME_DIR .. "tests/osd/workqueue.cpp",
+		MAME_DIR .. "src/emu/emucore.cpp",
+		MAME_DIR .. "src/emu/video/rgbgen.cpp",
+		MAME_DIR .. "src/emu/video/rgbsse.cpp",
+		MAME_DIR .. "src/emu/video/rgbvmx.cpp",
 	}
 
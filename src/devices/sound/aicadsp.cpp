@@ -4,6 +4,10 @@
 #include "emu.h"
 #include "aicadsp.h"
 
+// decode MPRO once when it changes instead of on every step;
+// set to 0 to run the original interpreter for comparison
+#define AICADSP_PREDECODE    1
+
 static UINT16 PACK(INT32 val)
 {
 	UINT32 temp;
@@ -55,11 +59,54 @@ static INT32 UNPACK(UINT16 val)
 	return uval;
 }
 
+static void aica_dsp_decode(AICADSP *DSP)
+{
+	int step;
+
+	for(step=0;step<128;++step)
+	{
+		UINT16 *IPtr=DSP->MPRO+step*8;
+		AICADSP_INST *I=DSP->INST+step;
+
+		I->TRA=(IPtr[0]>>9)&0x7F;
+		I->TWT=(IPtr[0]>>8)&0x01;
+		I->TWA=(IPtr[0]>>1)&0x7F;
+
+		I->XSEL=(IPtr[2]>>15)&0x01;
+		I->YSEL=(IPtr[2]>>13)&0x03;
+		I->IRA=(IPtr[2]>>7)&0x3F;
+		I->IWT=(IPtr[2]>>6)&0x01;
+		I->IWA=(IPtr[2]>>1)&0x1F;
+
+		I->TABLE=(IPtr[4]>>15)&0x01;
+		I->MWT=(IPtr[4]>>14)&0x01;
+		I->MRD=(IPtr[4]>>13)&0x01;
+		I->EWT=(IPtr[4]>>12)&0x01;
+		I->EWA=(IPtr[4]>>8)&0x0F;
+		I->ADRL=(IPtr[4]>>7)&0x01;
+		I->FRCL=(IPtr[4]>>6)&0x01;
+		I->SHIFT=(IPtr[4]>>4)&0x03;
+		I->YRL=(IPtr[4]>>3)&0x01;
+		I->NEGB=(IPtr[4]>>2)&0x01;
+		I->ZERO=(IPtr[4]>>1)&0x01;
+		I->BSEL=(IPtr[4]>>0)&0x01;
+
+		I->NOFL=(IPtr[6]>>15)&1;        //????
+		I->COEF=step;
+
+		I->MASA=(IPtr[6]>>9)&0x1f;  //???
+		I->ADREB=(IPtr[6]>>8)&0x1;
+		I->NXADR=(IPtr[6]>>7)&0x1;
+	}
+	DSP->Dirty=0;
+}
+
 void aica_dsp_init(AICADSP *DSP)
 {
 	memset(DSP,0,sizeof(AICADSP));
 	DSP->RBL=0x8000;
 	DSP->Stopped=1;
+	DSP->Dirty=1;
 }
 
 void aica_dsp_step(AICADSP *DSP)
@@ -80,6 +127,11 @@ void aica_dsp_step(AICADSP *DSP)
 	if(DSP->Stopped)
 		return;
 
+#if AICADSP_PREDECODE
+	if(DSP->Dirty)
+		aica_dsp_decode(DSP);
+#endif
+
 	memset(DSP->EFREG,0,2*16);
 #if 0
 	int dump=0;
@@ -89,6 +141,35 @@ void aica_dsp_step(AICADSP *DSP)
 #endif
 	for(step=0;step</*128*/DSP->LastStep;++step)
 	{
+#if AICADSP_PREDECODE
+		const AICADSP_INST *I=DSP->INST+step;
+
+		UINT32 TRA=I->TRA;
+		UINT32 TWT=I->TWT;
+		UINT32 TWA=I->TWA;
+		UINT32 XSEL=I->XSEL;
+		UINT32 YSEL=I->YSEL;
+		UINT32 IRA=I->IRA;
+		UINT32 IWT=I->IWT;
+		UINT32 IWA=I->IWA;
+		UINT32 TABLE=I->TABLE;
+		UINT32 MWT=I->MWT;
+		UINT32 MRD=I->MRD;
+		UINT32 EWT=I->EWT;
+		UINT32 EWA=I->EWA;
+		UINT32 ADRL=I->ADRL;
+		UINT32 FRCL=I->FRCL;
+		UINT32 SHIFT=I->SHIFT;
+		UINT32 YRL=I->YRL;
+		UINT32 NEGB=I->NEGB;
+		UINT32 ZERO=I->ZERO;
+		UINT32 BSEL=I->BSEL;
+		UINT32 NOFL=I->NOFL;
+		UINT32 COEF=I->COEF;
+		UINT32 MASA=I->MASA;
+		UINT32 ADREB=I->ADREB;
+		UINT32 NXADR=I->NXADR;
+#else
 		UINT16 *IPtr=DSP->MPRO+step*8;
 
 //      if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
@@ -124,6 +205,8 @@ void aica_dsp_step(AICADSP *DSP)
 		UINT32 ADREB=(IPtr[6]>>8)&0x1;
 		UINT32 NXADR=(IPtr[6]>>7)&0x1;
 
+#endif
+
 		INT64 v;
 
 		//operations are done at 24 bit precision
@@ -5,6 +5,15 @@
 #ifndef __AICADSP_H__
 #define __AICADSP_H__
 
+//a predecoded microprogram step
+struct AICADSP_INST
+{
+	UINT8 TRA, TWT, TWA;
+	UINT8 XSEL, YSEL, IRA, IWT, IWA;
+	UINT8 TABLE, MWT, MRD, EWT, EWA, ADRL, FRCL, SHIFT, YRL, NEGB, ZERO, BSEL;
+	UINT8 NOFL, COEF, MASA, ADREB, NXADR;
+};
+
 //the DSP Context
 struct AICADSP
 {
@@ -32,6 +41,10 @@ struct AICADSP
 
 	int Stopped;
 	int LastStep;
+
+//predecoded MPRO, rebuilt on the next step after MPRO is written
+	AICADSP_INST INST[128];
+	int Dirty;
 };
 
 void aica_dsp_init(AICADSP *DSP);
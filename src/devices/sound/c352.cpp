@@ -95,7 +95,7 @@ int c352_device::get_mseq_bit()
 	return (reg & 1);
 }
 
-void c352_device::mix_one_channel(unsigned long ch, long sample_count)
+long c352_device::fetch_one_channel(unsigned long ch, long sample_count)
 {
 	int i;
 
@@ -129,11 +129,11 @@ void c352_device::mix_one_channel(unsigned long ch, long sample_count)
 		if (pos > 0x1000000)
 		{
 			m_c352_ch[ch].flag &= ~C352_FLG_BUSY;
-			return;
+			return i;
 		}
 
-		sample = (char)m_direct->read_byte(pos);
-		nextsample = (char)m_direct->read_byte(pos+cnt);
+		sample = (char)m_rom.read_byte(pos);
+		nextsample = (char)m_rom.read_byte(pos+cnt);
 
 		// sample is muLaw, not 8-bit linear (Fighting Layer uses this extensively)
 		if (flag & C352_FLG_MULAW)
@@ -190,33 +190,7 @@ void c352_device::mix_one_channel(unsigned long ch, long sample_count)
 			sample = (short)(sample + ((nextsample-sample) * (((double)(0x0000ffff&offset) )/0x10000)));
 		}
 
-		if ( flag & C352_FLG_PHASEFL )
-		{
-			m_channel_l[i]  += ((-sample * m_c352_ch[ch].vol_l)>>8);
-		}
-		else
-		{
-			m_channel_l[i] += ((sample * m_c352_ch[ch].vol_l)>>8);
-		}
-
-		if ( flag & C352_FLG_PHASEFR )
-		{
-			m_channel_r[i]  += ((-sample * m_c352_ch[ch].vol_r)>>8);
-		}
-		else
-		{
-			m_channel_r[i] += ((sample * m_c352_ch[ch].vol_r)>>8);
-		}
-
-		if ( flag & C352_FLG_PHASERL )
-		{
-			m_channel_l2[i] += ((-sample * m_c352_ch[ch].vol_l2)>>8);
-		}
-		else
-		{
-			m_channel_l2[i] += ((sample * m_c352_ch[ch].vol_l2)>>8);
-		}
-		m_channel_r2[i] += ((sample * m_c352_ch[ch].vol_r2)>>8);
+		m_voice[i] = sample;
 
 		if ( (flag & C352_FLG_REVERSE) && (flag & C352_FLG_LOOP) )
 		{
@@ -274,7 +248,7 @@ void c352_device::mix_one_channel(unsigned long ch, long sample_count)
 				{
 					m_c352_ch[ch].flag |= C352_FLG_KEYOFF;
 					m_c352_ch[ch].flag &= ~C352_FLG_BUSY;
-					return;
+					return i + 1;
 				}
 			}
 		} else {
@@ -303,7 +277,7 @@ void c352_device::mix_one_channel(unsigned long ch, long sample_count)
 				{
 					m_c352_ch[ch].flag |= C352_FLG_KEYOFF;
 					m_c352_ch[ch].flag &= ~C352_FLG_BUSY;
-					return;
+					return i + 1;
 				}
 			}
 		}
@@ -313,6 +287,20 @@ void c352_device::mix_one_channel(unsigned long ch, long sample_count)
 	m_c352_ch[ch].noisebuf = noisebuf;
 	m_c352_ch[ch].pos = offset;
 	m_c352_ch[ch].current_addr = pos;
+
+	return i;
+}
+
+void c352_device::mix_one_channel(unsigned long ch, long sample_count)
+{
+	// phase inversion is taken from the flags as they were before fetching
+	UINT32 flag = m_c352_ch[ch].flag;
+	long count = fetch_one_channel(ch, sample_count);
+
+	pcm_mix_block(m_channel_l, m_voice, (flag & C352_FLG_PHASEFL) ? -m_c352_ch[ch].vol_l : m_c352_ch[ch].vol_l, 8, count);
+	pcm_mix_block(m_channel_r, m_voice, (flag & C352_FLG_PHASEFR) ? -m_c352_ch[ch].vol_r : m_c352_ch[ch].vol_r, 8, count);
+	pcm_mix_block(m_channel_l2, m_voice, (flag & C352_FLG_PHASERL) ? -m_c352_ch[ch].vol_l2 : m_c352_ch[ch].vol_l2, 8, count);
+	pcm_mix_block(m_channel_r2, m_voice, m_c352_ch[ch].vol_r2, 8, count);
 }
 
 
@@ -481,8 +469,10 @@ void c352_device::device_start()
 	double y_max = 127.0;
 	double u = 10.0;
 
-	// find our direct access
-	m_direct = &space().direct();
+	// fetch samples straight from the ROM backing our address space
+	memory_region *region = memregion(DEVICE_SELF);
+	if (region != nullptr)
+		m_rom.set(region->base(), region->bytes(), 0xffffff);
 
 	m_sample_rate_base = clock() / m_divider;
 
@@ -5,6 +5,8 @@
 #ifndef __C352_H__
 #define __C352_H__
 
+#include "pcmmix.h"
+
 //**************************************************************************
 //  INTERFACE CONFIGURATION MACROS
 //**************************************************************************
@@ -98,17 +100,19 @@ private:
 	int m_sample_rate_base;
 	int m_divider;
 
-	long m_channel_l[2048*2];
-	long m_channel_r[2048*2];
-	long m_channel_l2[2048*2];
-	long m_channel_r2[2048*2];
+	INT32 m_channel_l[2048*2];
+	INT32 m_channel_r[2048*2];
+	INT32 m_channel_l2[2048*2];
+	INT32 m_channel_r2[2048*2];
+	INT32 m_voice[2048*2];
 
 	short m_mulaw_table[256];
 	unsigned int m_mseq_reg;
-	direct_read_data *m_direct;
+	pcm_sample_rom m_rom;
 
 	// private functions
 	int get_mseq_bit(void);
+	long fetch_one_channel(unsigned long ch, long sample_count);
 	void mix_one_channel(unsigned long ch, long sample_count);
 	unsigned short read_reg16(unsigned long address);
 	void write_reg16(unsigned long address, unsigned short val);
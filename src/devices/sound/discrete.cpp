@@ -915,7 +915,7 @@ void discrete_device::device_start()
 	}
 
 	/* allocate a queue */
-	m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ | WORK_QUEUE_FLAG_AUDIO);
 
 	/* Process nodes which have a start func */
 	for_each(discrete_base_node **, node, &m_node_list)
@@ -11,6 +11,7 @@
 
 #include "emu.h"
 #include "k054539.h"
+#include "pcmmix.h"
 
 const device_type K054539 = &device_creator<k054539_device>;
 
@@ -113,72 +114,74 @@ void k054539_device::sound_stream_update(sound_stream &stream, stream_sample_t *
 		-64 * 0x100, -49 * 0x100, -36 * 0x100, -25 * 0x100, -16 * 0x100, -9 * 0x100, -4 * 0x100, -1 * 0x100
 	};
 
-
 	INT16 *rbase = (INT16 *)ram.get();
 
 	if(!(regs[0x22f] & 1))
 		return;
 
-	for(int sample = 0; sample != samples; sample++) {
-		double lval, rval;
-		if(!(flags & DISABLE_REVERB))
-			lval = rval = rbase[reverb_pos];
-		else
-			lval = rval = 0;
-		rbase[reverb_pos] = 0;
-
-		for(int ch=0; ch<8; ch++)
-			if(regs[0x22c] & (1<<ch)) {
-				unsigned char *base1 = regs + 0x20*ch;
-				unsigned char *base2 = regs + 0x200 + 0x2*ch;
-				channel *chan = channels + ch;
-
-				int delta = base1[0x00] | (base1[0x01] << 8) | (base1[0x02] << 16);
+	INT32 voice[8][PCMMIX_BLOCK_SAMPLES];
+	double lmix[PCMMIX_BLOCK_SAMPLES], rmix[PCMMIX_BLOCK_SAMPLES];
 
-				int vol = base1[0x03];
+	for(int base = 0; base < samples; base += PCMMIX_BLOCK_SAMPLES) {
+		int block = std::min(samples - base, PCMMIX_BLOCK_SAMPLES);
+		int count[8];
+		double lvols[8], rvols[8], rbvols[8];
 
-				int bval = vol + base1[0x04];
-				if (bval > 255)
-					bval = 255;
+		// run each keyed on channel over the block until it keys off
+		for(int ch=0; ch<8; ch++) {
+			unsigned char *base1 = regs + 0x20*ch;
+			unsigned char *base2 = regs + 0x200 + 0x2*ch;
+			channel *chan = channels + ch;
 
-				int pan = base1[0x05];
-				// DJ Main: 81-87 right, 88 middle, 89-8f left
-				if (pan >= 0x81 && pan <= 0x8f)
-					pan -= 0x81;
-				else if (pan >= 0x11 && pan <= 0x1f)
-					pan -= 0x11;
-				else
-					pan = 0x18 - 0x11;
+			int delta = base1[0x00] | (base1[0x01] << 8) | (base1[0x02] << 16);
 
-				double cur_gain = gain[ch];
+			int vol = base1[0x03];
 
-				double lvol = voltab[vol] * pantab[pan] * cur_gain;
-				if (lvol > VOL_CAP)
-					lvol = VOL_CAP;
+			int bval = vol + base1[0x04];
+			if (bval > 255)
+				bval = 255;
 
-				double rvol = voltab[vol] * pantab[0xe - pan] * cur_gain;
-				if (rvol > VOL_CAP)
-					rvol = VOL_CAP;
-
-				double rbvol= voltab[bval] * cur_gain / 2;
-				if (rbvol > VOL_CAP)
-					rbvol = VOL_CAP;
-
-				int rdelta = (base1[6] | (base1[7] << 8)) >> 3;
-				rdelta = (rdelta + reverb_pos) & 0x3fff;
+			int pan = base1[0x05];
+			// DJ Main: 81-87 right, 88 middle, 89-8f left
+			if (pan >= 0x81 && pan <= 0x8f)
+				pan -= 0x81;
+			else if (pan >= 0x11 && pan <= 0x1f)
+				pan -= 0x11;
+			else
+				pan = 0x18 - 0x11;
+
+			double cur_gain = gain[ch];
+
+			double lvol = voltab[vol] * pantab[pan] * cur_gain;
+			if (lvol > VOL_CAP)
+				lvol = VOL_CAP;
+
+			double rvol = voltab[vol] * pantab[0xe - pan] * cur_gain;
+			if (rvol > VOL_CAP)
+				rvol = VOL_CAP;
+
+			double rbvol= voltab[bval] * cur_gain / 2;
+			if (rbvol > VOL_CAP)
+				rbvol = VOL_CAP;
+
+			lvols[ch] = lvol;
+			rvols[ch] = rvol;
+			rbvols[ch] = rbvol;
+
+			int fdelta, chan_pdelta;
+			if(base2[0] & 0x20) {
+				delta = -delta;
+				fdelta = +0x10000;
+				chan_pdelta = -1;
+			} else {
+				fdelta = -0x10000;
+				chan_pdelta = +1;
+			}
 
+			for(count[ch] = 0; count[ch] != block && (regs[0x22c] & (1<<ch)); count[ch]++) {
+				int pdelta = chan_pdelta;
 				int cur_pos = (base1[0x0c] | (base1[0x0d] << 8) | (base1[0x0e] << 16)) & rom_mask;
 
-				int fdelta, pdelta;
-				if(base2[0] & 0x20) {
-					delta = -delta;
-					fdelta = +0x10000;
-					pdelta = -1;
-				} else {
-					fdelta = -0x10000;
-					pdelta = +1;
-				}
-
 				int cur_pfrac, cur_val, cur_pval;
 				if(cur_pos != chan->pos) {
 					chan->pos = cur_pos;
@@ -281,9 +284,7 @@ void k054539_device::sound_stream_update(sound_stream &stream, stream_sample_t *
 					LOG(("Unknown sample type %x for channel %d\n", base2[0] & 0xc, ch));
 					break;
 				}
-				lval += cur_val * lvol;
-				rval += cur_val * rvol;
-				rbase[(rdelta + reverb_pos) & 0x1fff] += INT16(cur_val*rbvol);
+				voice[ch][count[ch]] = cur_val;
 
 				chan->pos = cur_pos;
 				chan->pfrac = cur_pfrac;
@@ -296,9 +297,39 @@ void k054539_device::sound_stream_update(sound_stream &stream, stream_sample_t *
 					base1[0x0e] = cur_pos>>16 & 0xff;
 				}
 			}
-		reverb_pos = (reverb_pos + 1) & 0x1fff;
-		outputs[0][sample] = INT16(lval);
-		outputs[1][sample] = INT16(rval);
+		}
+
+		// the reverb buffer is read back one sample at a time, so feed it in order
+		for(int sample = 0; sample != block; sample++) {
+			double val;
+			if(!(flags & DISABLE_REVERB))
+				val = rbase[reverb_pos];
+			else
+				val = 0;
+			rbase[reverb_pos] = 0;
+
+			for(int ch=0; ch<8; ch++)
+				if(sample < count[ch]) {
+					unsigned char *base1 = regs + 0x20*ch;
+					int rdelta = (base1[6] | (base1[7] << 8)) >> 3;
+					rdelta = (rdelta + reverb_pos) & 0x3fff;
+					rbase[(rdelta + reverb_pos) & 0x1fff] += INT16(voice[ch][sample]*rbvols[ch]);
+				}
+
+			lmix[sample] = rmix[sample] = val;
+			reverb_pos = (reverb_pos + 1) & 0x1fff;
+		}
+
+		// add the channels on top of the reverb, in channel order
+		for(int ch=0; ch<8; ch++) {
+			pcm_mix_block(lmix, voice[ch], lvols[ch], count[ch]);
+			pcm_mix_block(rmix, voice[ch], rvols[ch], count[ch]);
+		}
+
+		for(int sample = 0; sample != block; sample++) {
+			outputs[0][base + sample] = INT16(lmix[sample]);
+			outputs[1][base + sample] = INT16(rmix[sample]);
+		}
 	}
 }
 
@@ -469,7 +469,6 @@ multipcm_device::multipcm_device(const machine_config &mconfig, const char *tag,
 		m_attack_step(nullptr),
 		m_decay_release_step(nullptr),
 		m_freq_step_table(nullptr),
-		m_direct(nullptr),
 		m_left_pan_table(nullptr),
 		m_right_pan_table(nullptr),
 		m_linear_to_exp_volume(nullptr),
@@ -506,8 +505,10 @@ void multipcm_device::device_config_complete()
 
 void multipcm_device::device_start()
 {
-	// find our direct access
-	m_direct = &space().direct();
+	// fetch samples straight from the ROM backing our address space
+	memory_region *region = memregion(DEVICE_SELF);
+	if (region != nullptr)
+		m_rom.set(region->base(), std::min<UINT32>(region->bytes(), 0x400000), 0xffffff);
 
 	const float clock_divider = 180.0f;
 	m_rate = (float)clock() / clock_divider;
@@ -612,7 +613,7 @@ void multipcm_device::device_start()
 
 		for (INT32 sample_byte = 0; sample_byte < 12; sample_byte++)
 		{
-			data[sample_byte] = (UINT8)m_direct->read_byte((sample * 12) + sample_byte);
+			data[sample_byte] = m_rom.read_byte((sample * 12) + sample_byte);
 		}
 
 		m_samples[sample].m_start = (data[0] << 16) | (data[1] << 8) | (data[2] << 0);
@@ -691,27 +692,30 @@ INT16 multipcm_device::clamp_to_int16(INT32 value)
 
 void multipcm_device::sound_stream_update(sound_stream &stream, stream_sample_t **inputs, stream_sample_t **outputs, INT32 samples)
 {
-	stream_sample_t  *datap[2];
+	INT32 smpl[PCMMIX_BLOCK_SAMPLES];
+	INT32 smpr[PCMMIX_BLOCK_SAMPLES];
+	INT32 voice[PCMMIX_BLOCK_SAMPLES];
+	INT32 lgain[PCMMIX_BLOCK_SAMPLES];
+	INT32 rgain[PCMMIX_BLOCK_SAMPLES];
 
-	datap[0] = outputs[0];
-	datap[1] = outputs[1];
+	for (INT32 base = 0; base < samples; base += PCMMIX_BLOCK_SAMPLES)
+	{
+		INT32 block = std::min(samples - base, PCMMIX_BLOCK_SAMPLES);
 
-	memset(datap[0], 0, sizeof(*datap[0]) * samples);
-	memset(datap[1], 0, sizeof(*datap[1]) * samples);
+		memset(smpl, 0, sizeof(smpl));
+		memset(smpr, 0, sizeof(smpr));
 
-	for (INT32 i = 0; i < samples; ++i)
-	{
-		INT32 smpl = 0;
-		INT32 smpr = 0;
 		for (INT32 sl = 0; sl < 28; ++sl)
 		{
 			slot_t *slot = m_slots + sl;
-			if (slot->m_playing)
+			INT32 count;
+
+			for (count = 0; count < block && slot->m_playing; ++count)
 			{
 				UINT32 vol = (slot->m_total_level >> TL_SHIFT) | (slot->m_pan << 7);
 				UINT32 adr = slot->m_offset >> TL_SHIFT;
 				UINT32 step = slot->m_step;
-				INT32 csample = (INT16) (m_direct->read_byte(slot->m_base + adr) << 8);
+				INT32 csample = (INT16) (m_rom.read_byte(slot->m_base + adr) << 8);
 				INT32 fpart = slot->m_offset & ((1 << TL_SHIFT) - 1);
 				INT32 sample = (csample * fpart + slot->m_prev_sample * ((1 << TL_SHIFT) - fpart)) >> TL_SHIFT;
 
@@ -743,14 +747,19 @@ void multipcm_device::sound_stream_update(sound_stream &stream, stream_sample_t
 					sample >>= TL_SHIFT;
 				}
 
-				sample = (sample * envelope_generator_update(slot)) >> 10;
-
-				smpl += (m_left_pan_table[vol] * sample) >> TL_SHIFT;
-				smpr += (m_right_pan_table[vol] * sample) >> TL_SHIFT;
+				voice[count] = (sample * envelope_generator_update(slot)) >> 10;
+				lgain[count] = m_left_pan_table[vol];
+				rgain[count] = m_right_pan_table[vol];
 			}
+
+			pcm_mix_block(smpl, voice, lgain, TL_SHIFT, count);
+			pcm_mix_block(smpr, voice, rgain, TL_SHIFT, count);
 		}
 
-		datap[0][i] = clamp_to_int16(smpl);
-		datap[1][i] = clamp_to_int16(smpr);
+		for (INT32 i = 0; i < block; ++i)
+		{
+			outputs[0][base + i] = clamp_to_int16(smpl[i]);
+			outputs[1][base + i] = clamp_to_int16(smpr[i]);
+		}
 	}
 }
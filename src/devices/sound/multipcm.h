@@ -5,6 +5,8 @@
 #ifndef __MULTIPCM_H__
 #define __MULTIPCM_H__
 
+#include "pcmmix.h"
+
 class multipcm_device : public device_t,
 						public device_sound_interface,
 						public device_memory_interface
@@ -110,7 +112,7 @@ private:
 	UINT32 *m_decay_release_step;   // Envelope step tables
 	UINT32 *m_freq_step_table;      // Frequency step table
 
-	direct_read_data *m_direct;
+	pcm_sample_rom m_rom;
 
 	INT32 *m_left_pan_table;
 	INT32 *m_right_pan_table;
@@ -0,0 +1,169 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    pcmmix.h
+
+    Block voice mixing helpers for PCM sample playback chips.
+
+    Chips generate one voice at a time into a block of INT32 samples,
+    then accumulate the block into their output buffers with one of the
+    pcm_mix_block() variants. Results are identical to accumulating the
+    same expressions one sample at a time.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __PCMMIX_H__
+#define __PCMMIX_H__
+
+/* use SSE2 on 64-bit implementations, where it can be assumed */
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define PCMMIX_USE_SSE2     1
+#include <emmintrin.h>
+#else
+#define PCMMIX_USE_SSE2     0
+#endif
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// suggested number of samples per voice block
+const int PCMMIX_BLOCK_SAMPLES = 64;
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> pcm_sample_rom
+
+// direct access to a sample ROM region, replacing per-sample read_byte()
+// calls through an address space whose map is a single ROM range
+class pcm_sample_rom
+{
+public:
+	pcm_sample_rom()
+		: m_base(nullptr),
+			m_bytes(0),
+			m_addrmask(0) { }
+
+	// base/bytes describe the mapped ROM, addrmask the width of the address space;
+	// addresses past the ROM read as 0, like unmapped space
+	void set(const UINT8 *base, UINT32 bytes, UINT32 addrmask)
+	{
+		m_base = base;
+		m_bytes = bytes;
+		m_addrmask = addrmask;
+	}
+
+	UINT8 read_byte(UINT32 offset) const
+	{
+		offset &= m_addrmask;
+		return (offset < m_bytes) ? m_base[offset] : 0;
+	}
+
+private:
+	const UINT8 *   m_base;
+	UINT32          m_bytes;
+	UINT32          m_addrmask;
+};
+
+
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+#if PCMMIX_USE_SSE2
+// low 32 bits of a 4x32-bit multiply; SSE2 has no pmulld
+static inline __m128i pcm_mullo_epi32(__m128i a, __m128i b)
+{
+	__m128i even = _mm_mul_epu32(a, b);
+	__m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+#endif
+
+
+//-------------------------------------------------
+//  pcm_mix_block - accumulate a voice block with
+//  a constant gain: out[i] += (in[i] * gain) >> shift
+//-------------------------------------------------
+
+template<typename _OutType>
+static inline void pcm_mix_block(_OutType *out, const INT32 *in, INT32 gain, int shift, int count)
+{
+	int i = 0;
+
+#if PCMMIX_USE_SSE2
+	if (sizeof(_OutType) == sizeof(INT32))
+	{
+		const __m128i vgain = _mm_set1_epi32(gain);
+		const __m128i vshift = _mm_cvtsi32_si128(shift);
+		for ( ; i + 4 <= count; i += 4)
+		{
+			__m128i prod = _mm_sra_epi32(pcm_mullo_epi32(_mm_loadu_si128((const __m128i *)&in[i]), vgain), vshift);
+			_mm_storeu_si128((__m128i *)&out[i], _mm_add_epi32(_mm_loadu_si128((const __m128i *)&out[i]), prod));
+		}
+	}
+#endif
+
+	for ( ; i < count; i++)
+		out[i] += (in[i] * gain) >> shift;
+}
+
+
+//-------------------------------------------------
+//  pcm_mix_block - accumulate a voice block with
+//  a per-sample gain: out[i] += (in[i] * gain[i]) >> shift
+//-------------------------------------------------
+
+template<typename _OutType>
+static inline void pcm_mix_block(_OutType *out, const INT32 *in, const INT32 *gain, int shift, int count)
+{
+	int i = 0;
+
+#if PCMMIX_USE_SSE2
+	if (sizeof(_OutType) == sizeof(INT32))
+	{
+		const __m128i vshift = _mm_cvtsi32_si128(shift);
+		for ( ; i + 4 <= count; i += 4)
+		{
+			__m128i prod = pcm_mullo_epi32(_mm_loadu_si128((const __m128i *)&in[i]), _mm_loadu_si128((const __m128i *)&gain[i]));
+			prod = _mm_sra_epi32(prod, vshift);
+			_mm_storeu_si128((__m128i *)&out[i], _mm_add_epi32(_mm_loadu_si128((const __m128i *)&out[i]), prod));
+		}
+	}
+#endif
+
+	for ( ; i < count; i++)
+		out[i] += (in[i] * gain[i]) >> shift;
+}
+
+
+//-------------------------------------------------
+//  pcm_mix_block - accumulate a voice block into
+//  a floating point mix: out[i] += in[i] * gain
+//-------------------------------------------------
+
+static inline void pcm_mix_block(double *out, const INT32 *in, double gain, int count)
+{
+	int i = 0;
+
+#if PCMMIX_USE_SSE2
+	const __m128d vgain = _mm_set1_pd(gain);
+	for ( ; i + 2 <= count; i += 2)
+	{
+		__m128d prod = _mm_mul_pd(_mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i *)&in[i])), vgain);
+		_mm_storeu_pd(&out[i], _mm_add_pd(_mm_loadu_pd(&out[i]), prod));
+	}
+#endif
+
+	for ( ; i < count; i++)
+		out[i] += in[i] * gain;
+}
+
+#endif /* __PCMMIX_H__ */
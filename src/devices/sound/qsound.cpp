@@ -25,6 +25,7 @@
 
 #include "emu.h"
 #include "qsound.h"
+#include "pcmmix.h"
 
 // device type definition
 const device_type QSOUND = &device_creator<qsound_device>;
@@ -147,44 +148,51 @@ void qsound_device::sound_stream_update(sound_stream &stream, stream_sample_t **
 	memset(outputs[0], 0, samples * sizeof(*outputs[0]));
 	memset(outputs[1], 0, samples * sizeof(*outputs[1]));
 
-	for (auto & elem : m_channel)
+	INT32 voice[PCMMIX_BLOCK_SAMPLES];
+
+	for (int base = 0; base < samples; base += PCMMIX_BLOCK_SAMPLES)
 	{
-		if (elem.enabled)
-		{
-			stream_sample_t *lmix=outputs[0];
-			stream_sample_t *rmix=outputs[1];
+		int block = std::min(samples - base, PCMMIX_BLOCK_SAMPLES);
 
-			// Go through the buffer and add voice contributions
-			for (int i = 0; i < samples; i++)
+		for (auto & elem : m_channel)
+		{
+			if (elem.enabled)
 			{
-				elem.address += (elem.step_ptr >> 12);
-				elem.step_ptr &= 0xfff;
-				elem.step_ptr += elem.freq;
-
-				if (elem.address >= elem.end)
+				// Go through the block and fetch the voice's samples
+				int count;
+				for (count = 0; count < block; count++)
 				{
-					if (elem.loop)
-					{
-						// Reached the end, restart the loop
-						elem.address -= elem.loop;
-
-						// Make sure we don't overflow (what does the real chip do in this case?)
-						if (elem.address >= elem.end)
-							elem.address = elem.end - elem.loop;
+					elem.address += (elem.step_ptr >> 12);
+					elem.step_ptr &= 0xfff;
+					elem.step_ptr += elem.freq;
 
-						elem.address &= 0xffff;
-					}
-					else
+					if (elem.address >= elem.end)
 					{
-						// Reached the end of a non-looped sample
-						elem.enabled = false;
-						break;
+						if (elem.loop)
+						{
+							// Reached the end, restart the loop
+							elem.address -= elem.loop;
+
+							// Make sure we don't overflow (what does the real chip do in this case?)
+							if (elem.address >= elem.end)
+								elem.address = elem.end - elem.loop;
+
+							elem.address &= 0xffff;
+						}
+						else
+						{
+							// Reached the end of a non-looped sample
+							elem.enabled = false;
+							break;
+						}
 					}
+
+					voice[count] = read_sample(elem.bank | elem.address);
 				}
 
-				INT8 sample = read_sample(elem.bank | elem.address);
-				*lmix++ += ((sample * elem.lvol * elem.vol) >> 14);
-				*rmix++ += ((sample * elem.rvol * elem.vol) >> 14);
+				// Add the voice contributions
+				pcm_mix_block(outputs[0] + base, voice, elem.lvol * elem.vol, 14, count);
+				pcm_mix_block(outputs[1] + base, voice, elem.rvol * elem.vol, 14, count);
 			}
 		}
 	}
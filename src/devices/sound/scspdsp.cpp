@@ -3,6 +3,10 @@
 #include "emu.h"
 #include "scspdsp.h"
 
+// decode MPRO once when it changes instead of on every step;
+// set to 0 to run the original interpreter for comparison
+#define SCSPDSP_PREDECODE    1
+
 static UINT16 PACK(INT32 val)
 {
 	UINT32 temp;
@@ -54,11 +58,54 @@ static INT32 UNPACK(UINT16 val)
 	return uval;
 }
 
+static void SCSPDSP_Decode(SCSPDSP *DSP)
+{
+	int step;
+
+	for(step=0;step<128;++step)
+	{
+		UINT16 *IPtr=DSP->MPRO+step*4;
+		SCSPDSP_INST *I=DSP->INST+step;
+
+		I->TRA=(IPtr[0]>>8)&0x7F;
+		I->TWT=(IPtr[0]>>7)&0x01;
+		I->TWA=(IPtr[0]>>0)&0x7F;
+
+		I->XSEL=(IPtr[1]>>15)&0x01;
+		I->YSEL=(IPtr[1]>>13)&0x03;
+		I->IRA=(IPtr[1]>>6)&0x3F;
+		I->IWT=(IPtr[1]>>5)&0x01;
+		I->IWA=(IPtr[1]>>0)&0x1F;
+
+		I->TABLE=(IPtr[2]>>15)&0x01;
+		I->MWT=(IPtr[2]>>14)&0x01;
+		I->MRD=(IPtr[2]>>13)&0x01;
+		I->EWT=(IPtr[2]>>12)&0x01;
+		I->EWA=(IPtr[2]>>8)&0x0F;
+		I->ADRL=(IPtr[2]>>7)&0x01;
+		I->FRCL=(IPtr[2]>>6)&0x01;
+		I->SHIFT=(IPtr[2]>>4)&0x03;
+		I->YRL=(IPtr[2]>>3)&0x01;
+		I->NEGB=(IPtr[2]>>2)&0x01;
+		I->ZERO=(IPtr[2]>>1)&0x01;
+		I->BSEL=(IPtr[2]>>0)&0x01;
+
+		I->NOFL=(IPtr[3]>>15)&1;        //????
+		I->COEF=(IPtr[3]>>9)&0x3f;
+
+		I->MASA=(IPtr[3]>>2)&0x1f;  //???
+		I->ADREB=(IPtr[3]>>1)&0x1;
+		I->NXADR=(IPtr[3]>>0)&0x1;
+	}
+	DSP->Dirty=0;
+}
+
 void SCSPDSP_Init(SCSPDSP *DSP)
 {
 	memset(DSP,0,sizeof(SCSPDSP));
 	DSP->RBL=0x8000;
 	DSP->Stopped=1;
+	DSP->Dirty=1;
 }
 
 void SCSPDSP_Step(SCSPDSP *DSP)
@@ -79,6 +126,11 @@ void SCSPDSP_Step(SCSPDSP *DSP)
 	if(DSP->Stopped)
 		return;
 
+#if SCSPDSP_PREDECODE
+	if(DSP->Dirty)
+		SCSPDSP_Decode(DSP);
+#endif
+
 	memset(DSP->EFREG,0,2*16);
 #if 0
 	int dump=0;
@@ -88,6 +140,35 @@ void SCSPDSP_Step(SCSPDSP *DSP)
 #endif
 	for(step=0;step</*128*/DSP->LastStep;++step)
 	{
+#if SCSPDSP_PREDECODE
+		const SCSPDSP_INST *I=DSP->INST+step;
+
+		UINT32 TRA=I->TRA;
+		UINT32 TWT=I->TWT;
+		UINT32 TWA=I->TWA;
+		UINT32 XSEL=I->XSEL;
+		UINT32 YSEL=I->YSEL;
+		UINT32 IRA=I->IRA;
+		UINT32 IWT=I->IWT;
+		UINT32 IWA=I->IWA;
+		UINT32 TABLE=I->TABLE;
+		UINT32 MWT=I->MWT;
+		UINT32 MRD=I->MRD;
+		UINT32 EWT=I->EWT;
+		UINT32 EWA=I->EWA;
+		UINT32 ADRL=I->ADRL;
+		UINT32 FRCL=I->FRCL;
+		UINT32 SHIFT=I->SHIFT;
+		UINT32 YRL=I->YRL;
+		UINT32 NEGB=I->NEGB;
+		UINT32 ZERO=I->ZERO;
+		UINT32 BSEL=I->BSEL;
+		UINT32 NOFL=I->NOFL;
+		UINT32 COEF=I->COEF;
+		UINT32 MASA=I->MASA;
+		UINT32 ADREB=I->ADREB;
+		UINT32 NXADR=I->NXADR;
+#else
 		UINT16 *IPtr=DSP->MPRO+step*4;
 
 //      if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
@@ -123,6 +204,8 @@ void SCSPDSP_Step(SCSPDSP *DSP)
 		UINT32 ADREB=(IPtr[3]>>1)&0x1;
 		UINT32 NXADR=(IPtr[3]>>0)&0x1;
 
+#endif
+
 		INT64 v;
 
 		//operations are done at 24 bit precision
@@ -5,6 +5,15 @@
 #ifndef __SCSPDSP_H__
 #define __SCSPDSP_H__
 
+//a predecoded microprogram step
+struct SCSPDSP_INST
+{
+	UINT8 TRA, TWT, TWA;
+	UINT8 XSEL, YSEL, IRA, IWT, IWA;
+	UINT8 TABLE, MWT, MRD, EWT, EWA, ADRL, FRCL, SHIFT, YRL, NEGB, ZERO, BSEL;
+	UINT8 NOFL, COEF, MASA, ADREB, NXADR;
+};
+
 //the DSP Context
 struct SCSPDSP
 {
@@ -32,6 +41,10 @@ struct SCSPDSP
 
 	int Stopped;
 	int LastStep;
+
+//predecoded MPRO, rebuilt on the next step after MPRO is written
+	SCSPDSP_INST INST[128];
+	int Dirty;
 };
 
 void SCSPDSP_Init(SCSPDSP *DSP);
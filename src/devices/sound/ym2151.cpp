@@ -8,6 +8,7 @@
 
 #include "emu.h"
 #include "ym2151.h"
+#include "ym2151mix.h"
 
 
 /* undef this to not use MAME timer system */
@@ -23,6 +24,9 @@
 #define LOG_CYM_FILE 0
 static FILE * cymfile = nullptr;
 
+/* number of samples generated per batch by ym2151_update_one() */
+#define BATCH_LEN       32
+
 
 /* struct describing a single operator */
 struct YM2151Operator
@@ -164,6 +168,16 @@ struct YM2151
 
 	UINT32      noise_tab[32];          /* 17bit Noise Generator periods */
 
+	/*  Batch buffers filled by ym2151_update_one(). The envelope and phase
+	*   generators are run for a whole batch first, then each channel's
+	*   operators are evaluated over the batch and the results are mixed.
+	*   Scratch only - not part of the saved state.
+	*/
+	UINT32      batch_env[32][BATCH_LEN];   /* operator attenuation (volume_calc) per sample */
+	UINT32      batch_phase[32][BATCH_LEN]; /* operator phase per sample */
+	UINT32      batch_noise[BATCH_LEN];     /* noise generator output bit per sample */
+	INT32       batch_out[8][BATCH_LEN];    /* channel outputs per sample */
+
 	void (*irqhandler)(device_t *device, int irq);      /* IRQ function handler */
 	void (*porthandler)(device_t *, offs_t, UINT8);     /* port write function handler */
 
@@ -1650,12 +1664,12 @@ void ym2151_reset_chip(void *_chip)
 
 
 
-static inline signed int op_calc(YM2151Operator * OP, unsigned int env, signed int pm)
+static inline signed int op_calc(UINT32 phase, unsigned int env, signed int pm)
 {
 	UINT32 p;
 
 
-	p = (env<<3) + sin_tab[ ( ((signed int)((OP->phase & ~FREQ_MASK) + (pm<<15))) >> FREQ_SH ) & SIN_MASK ];
+	p = (env<<3) + sin_tab[ ( ((signed int)((phase & ~FREQ_MASK) + (pm<<15))) >> FREQ_SH ) & SIN_MASK ];
 
 	if (p >= TL_TAB_LEN)
 		return 0;
@@ -1663,15 +1677,15 @@ static inline signed int op_calc(YM2151Operator * OP, unsigned int env, signed i
 	return tl_tab[p];
 }
 
-static inline signed int op_calc1(YM2151Operator * OP, unsigned int env, signed int pm)
+static inline signed int op_calc1(UINT32 phase, unsigned int env, signed int pm)
 {
 	UINT32 p;
 	INT32  i;
 
 
-	i = (OP->phase & ~FREQ_MASK) + pm;
+	i = (phase & ~FREQ_MASK) + pm;
 
-/*logerror("i=%08x (i>>16)&511=%8i phase=%i [pm=%08x] ",i, (i>>16)&511, OP->phase>>FREQ_SH, pm);*/
+/*logerror("i=%08x (i>>16)&511=%8i phase=%i [pm=%08x] ",i, (i>>16)&511, phase>>FREQ_SH, pm);*/
 
 	p = (env<<3) + sin_tab[ (i>>FREQ_SH) & SIN_MASK];
 
@@ -1687,20 +1701,22 @@ static inline signed int op_calc1(YM2151Operator * OP, unsigned int env, signed
 
 #define volume_calc(OP) ((OP)->tl + ((UINT32)(OP)->volume) + (AM & (OP)->AMmask))
 
-static inline void chan_calc(YM2151 *PSG, unsigned int chan)
+/* envelope and phase of operator 'n' at sample 's' of the current batch */
+#define BATCH_ENV(n)    (PSG->batch_env[(n)][s])
+#define BATCH_PHASE(n)  (PSG->batch_phase[(n)][s])
+
+static inline void chan_calc(YM2151 *PSG, unsigned int chan, unsigned int s)
 {
 	YM2151Operator *op;
 	unsigned int env;
-	UINT32 AM = 0;
+	unsigned int n = chan*4;
 
 	PSG->m2 = PSG->c1 = PSG->c2 = PSG->mem = 0;
-	op = &PSG->oper[chan*4];    /* M1 */
+	op = &PSG->oper[n];         /* M1 */
 
 	*op->mem_connect = op->mem_value;   /* restore delayed sample (MEM) value to m2 or c2 */
 
-	if (op->ams)
-		AM = PSG->lfa << (op->ams-1);
-	env = volume_calc(op);
+	env = BATCH_ENV(n);
 	{
 		INT32 out = op->fb_out_prev + op->fb_out_curr;
 		op->fb_out_prev = op->fb_out_curr;
@@ -1717,40 +1733,37 @@ static inline void chan_calc(YM2151 *PSG, unsigned int chan)
 		{
 			if (!op->fb_shift)
 				out=0;
-			op->fb_out_curr = op_calc1(op, env, (out<<op->fb_shift) );
+			op->fb_out_curr = op_calc1(BATCH_PHASE(n), env, (out<<op->fb_shift) );
 		}
 	}
 
-	env = volume_calc(op+1);    /* M2 */
+	env = BATCH_ENV(n+1);       /* M2 */
 	if (env < ENV_QUIET)
-		*(op+1)->connect += op_calc(op+1, env, PSG->m2);
+		*(op+1)->connect += op_calc(BATCH_PHASE(n+1), env, PSG->m2);
 
-	env = volume_calc(op+2);    /* C1 */
+	env = BATCH_ENV(n+2);       /* C1 */
 	if (env < ENV_QUIET)
-		*(op+2)->connect += op_calc(op+2, env, PSG->c1);
+		*(op+2)->connect += op_calc(BATCH_PHASE(n+2), env, PSG->c1);
 
-	env = volume_calc(op+3);    /* C2 */
+	env = BATCH_ENV(n+3);       /* C2 */
 	if (env < ENV_QUIET)
-		PSG->chanout[chan]    += op_calc(op+3, env, PSG->c2);
+		PSG->chanout[chan]    += op_calc(BATCH_PHASE(n+3), env, PSG->c2);
 
 	/* M1 */
 	op->mem_value = PSG->mem;
 }
 
-static inline void chan7_calc(YM2151 *PSG)
+static inline void chan7_calc(YM2151 *PSG, unsigned int s)
 {
 	YM2151Operator *op;
 	unsigned int env;
-	UINT32 AM = 0;
 
 	PSG->m2 = PSG->c1 = PSG->c2 = PSG->mem = 0;
 	op = &PSG->oper[7*4];       /* M1 */
 
 	*op->mem_connect = op->mem_value;   /* restore delayed sample (MEM) value to m2 or c2 */
 
-	if (op->ams)
-		AM = PSG->lfa << (op->ams-1);
-	env = volume_calc(op);
+	env = BATCH_ENV(28);
 	{
 		INT32 out = op->fb_out_prev + op->fb_out_curr;
 		op->fb_out_prev = op->fb_out_curr;
@@ -1767,19 +1780,19 @@ static inline void chan7_calc(YM2151 *PSG)
 		{
 			if (!op->fb_shift)
 				out=0;
-			op->fb_out_curr = op_calc1(op, env, (out<<op->fb_shift) );
+			op->fb_out_curr = op_calc1(BATCH_PHASE(28), env, (out<<op->fb_shift) );
 		}
 	}
 
-	env = volume_calc(op+1);    /* M2 */
+	env = BATCH_ENV(29);        /* M2 */
 	if (env < ENV_QUIET)
-		*(op+1)->connect += op_calc(op+1, env, PSG->m2);
+		*(op+1)->connect += op_calc(BATCH_PHASE(29), env, PSG->m2);
 
-	env = volume_calc(op+2);    /* C1 */
+	env = BATCH_ENV(30);        /* C1 */
 	if (env < ENV_QUIET)
-		*(op+2)->connect += op_calc(op+2, env, PSG->c1);
+		*(op+2)->connect += op_calc(BATCH_PHASE(30), env, PSG->c1);
 
-	env = volume_calc(op+3);    /* C2 */
+	env = BATCH_ENV(31);        /* C2 */
 	if (PSG->noise & 0x80)
 	{
 		UINT32 noiseout;
@@ -1787,17 +1800,81 @@ static inline void chan7_calc(YM2151 *PSG)
 		noiseout = 0;
 		if (env < 0x3ff)
 			noiseout = (env ^ 0x3ff) * 2;   /* range of the YM2151 noise output is -2044 to 2040 */
-		PSG->chanout[7] += ((PSG->noise_rng&0x10000) ? noiseout: -noiseout); /* bit 16 -> output */
+		PSG->chanout[7] += (PSG->batch_noise[s] ? noiseout: -noiseout); /* bit 16 -> output */
 	}
 	else
 	{
 		if (env < ENV_QUIET)
-			PSG->chanout[7] += op_calc(op+3, env, PSG->c2);
+			PSG->chanout[7] += op_calc(BATCH_PHASE(31), env, PSG->c2);
 	}
 	/* M1 */
 	op->mem_value = PSG->mem;
 }
 
+/*  Store the envelope and phase of all 32 operators for sample 's' of the
+*   current batch. Must be called at the point where the scalar generator
+*   would evaluate the channels, i.e. after advance_eg() and before advance().
+*/
+static inline void batch_capture(YM2151 *PSG, unsigned int s)
+{
+	YM2151Operator *op = &PSG->oper[0];
+	unsigned int n;
+
+	for (n = 0; n < 32; n += 4, op += 4)
+	{
+		UINT32 AM = 0;
+
+		if (op->ams)
+			AM = PSG->lfa << (op->ams-1);
+
+		PSG->batch_env[n+0][s] = volume_calc(op+0);
+		PSG->batch_env[n+1][s] = volume_calc(op+1);
+		PSG->batch_env[n+2][s] = volume_calc(op+2);
+		PSG->batch_env[n+3][s] = volume_calc(op+3);
+		PSG->batch_phase[n+0][s] = (op+0)->phase;
+		PSG->batch_phase[n+1][s] = (op+1)->phase;
+		PSG->batch_phase[n+2][s] = (op+2)->phase;
+		PSG->batch_phase[n+3][s] = (op+3)->phase;
+	}
+	PSG->batch_noise[s] = PSG->noise_rng & 0x10000;
+}
+
+/*  Returns true if channel 'chan' produces silence over the first 'length'
+*   samples of the batch without changing its state: all four operators are
+*   below ENV_QUIET for every sample and nothing is left in the feedback or
+*   MEM delay lines.
+*/
+static inline bool batch_chan_silent(YM2151 *PSG, unsigned int chan, int length)
+{
+	YM2151Operator *op = &PSG->oper[chan*4];
+	int n, s;
+
+	if (op->fb_out_prev | op->fb_out_curr | op->mem_value)
+		return false;
+	if ((chan == 7) && (PSG->noise & 0x80))
+		return false;
+
+	for (n = chan*4; n < chan*4 + 4; n++)
+	{
+		const UINT32 *env = PSG->batch_env[n];
+		s = 0;
+#if YM2151_USE_SSE2
+		/* env values are well below 2^31, so a signed compare is safe */
+		const __m128i quiet = _mm_set1_epi32(ENV_QUIET);
+		for ( ; s + 4 <= length; s += 4)
+		{
+			__m128i loud = _mm_cmplt_epi32(_mm_loadu_si128((const __m128i *)&env[s]), quiet);
+			if (_mm_movemask_epi8(loud))
+				return false;
+		}
+#endif
+		for ( ; s < length; s++)
+			if (env[s] < ENV_QUIET)
+				return false;
+	}
+	return true;
+}
+
 
 
 
@@ -2380,8 +2457,8 @@ void ym2151_update_one(void *chip, SAMP **buffers, int length)
 {
 	YM2151 *PSG = (YM2151 *)chip;
 	signed int *chanout = PSG->chanout;
-	int i;
-	signed int outl,outr;
+	int i, s, batch;
+	unsigned int chan;
 	SAMP *bufL, *bufR;
 
 	bufL = buffers[0];
@@ -2406,86 +2483,77 @@ void ym2151_update_one(void *chip, SAMP **buffers, int length)
 	}
 #endif
 
-	for (i=0; i<length; i++)
+	for (i=0; i<length; i+=batch)
 	{
-		advance_eg(PSG);
-
-		chanout[0] = 0;
-		chanout[1] = 0;
-		chanout[2] = 0;
-		chanout[3] = 0;
-		chanout[4] = 0;
-		chanout[5] = 0;
-		chanout[6] = 0;
-		chanout[7] = 0;
-
-		chan_calc(PSG, 0);
-		SAVE_SINGLE_CHANNEL(0)
-		chan_calc(PSG, 1);
-		SAVE_SINGLE_CHANNEL(1)
-		chan_calc(PSG, 2);
-		SAVE_SINGLE_CHANNEL(2)
-		chan_calc(PSG, 3);
-		SAVE_SINGLE_CHANNEL(3)
-		chan_calc(PSG, 4);
-		SAVE_SINGLE_CHANNEL(4)
-		chan_calc(PSG, 5);
-		SAVE_SINGLE_CHANNEL(5)
-		chan_calc(PSG, 6);
-		SAVE_SINGLE_CHANNEL(6)
-		chan7_calc(PSG);
-		SAVE_SINGLE_CHANNEL(7)
-
-		outl = chanout[0] & PSG->pan[0];
-		outr = chanout[0] & PSG->pan[1];
-		outl += (chanout[1] & PSG->pan[2]);
-		outr += (chanout[1] & PSG->pan[3]);
-		outl += (chanout[2] & PSG->pan[4]);
-		outr += (chanout[2] & PSG->pan[5]);
-		outl += (chanout[3] & PSG->pan[6]);
-		outr += (chanout[3] & PSG->pan[7]);
-		outl += (chanout[4] & PSG->pan[8]);
-		outr += (chanout[4] & PSG->pan[9]);
-		outl += (chanout[5] & PSG->pan[10]);
-		outr += (chanout[5] & PSG->pan[11]);
-		outl += (chanout[6] & PSG->pan[12]);
-		outr += (chanout[6] & PSG->pan[13]);
-		outl += (chanout[7] & PSG->pan[14]);
-		outr += (chanout[7] & PSG->pan[15]);
-
-		outl >>= FINAL_SH;
-		outr >>= FINAL_SH;
-		if (outl > MAXOUT) outl = MAXOUT;
-			else if (outl < MINOUT) outl = MINOUT;
-		if (outr > MAXOUT) outr = MAXOUT;
-			else if (outr < MINOUT) outr = MINOUT;
-		((SAMP*)bufL)[i] = (SAMP)outl;
-		((SAMP*)bufR)[i] = (SAMP)outr;
-
-		SAVE_ALL_CHANNELS
+		batch = length - i;
+		if (batch > BATCH_LEN)
+			batch = BATCH_LEN;
+
+		/* run the envelope, LFO, noise and phase generators for the whole batch */
+		for (s=0; s<batch; s++)
+		{
+			advance_eg(PSG);
+
+			batch_capture(PSG, s);
 
 #ifdef USE_MAME_TIMERS
-		/* ASG 980324 - handled by real timers now */
+			/* ASG 980324 - handled by real timers now */
 #else
-		/* calculate timer A */
-		if (PSG->tim_A)
-		{
-			PSG->tim_A_val -= ( 1 << TIMER_SH );
-			if (PSG->tim_A_val <= 0)
+			/* calculate timer A */
+			if (PSG->tim_A)
 			{
-				PSG->tim_A_val += PSG->tim_A_tab[ PSG->timer_A_index ];
-				if (PSG->irq_enable & 0x04)
+				PSG->tim_A_val -= ( 1 << TIMER_SH );
+				if (PSG->tim_A_val <= 0)
 				{
-					int oldstate = PSG->status & 3;
-					PSG->status |= 1;
-					if ((!oldstate) && (PSG->irqhandler)) (*PSG->irqhandler)(chip->device, 1);
+					PSG->tim_A_val += PSG->tim_A_tab[ PSG->timer_A_index ];
+					if (PSG->irq_enable & 0x04)
+					{
+						int oldstate = PSG->status & 3;
+						PSG->status |= 1;
+						if ((!oldstate) && (PSG->irqhandler)) (*PSG->irqhandler)(chip->device, 1);
+					}
+					if (PSG->irq_enable & 0x80)
+						PSG->csm_req = 2;   /* request KEY ON / KEY OFF sequence */
 				}
-				if (PSG->irq_enable & 0x80)
-					PSG->csm_req = 2;   /* request KEY ON / KEY OFF sequence */
 			}
+#endif
+			advance(PSG);
+		}
+
+		/* evaluate the operators channel by channel; channels are independent of each other */
+		for (chan=0; chan<8; chan++)
+		{
+			INT32 *out = PSG->batch_out[chan];
+
+			if (batch_chan_silent(PSG, chan, batch))
+			{
+				memset(out, 0, batch * sizeof(out[0]));
+				continue;
+			}
+
+			for (s=0; s<batch; s++)
+			{
+				chanout[chan] = 0;
+				if (chan < 7)
+					chan_calc(PSG, chan, s);
+				else
+					chan7_calc(PSG, s);
+				SAVE_SINGLE_CHANNEL(chan)
+				out[s] = chanout[chan];
+			}
+		}
+
+		/* mix the channels down to left/right */
+		ym2151_mix<FINAL_SH, MINOUT, MAXOUT>(&PSG->batch_out[0][0], BATCH_LEN, PSG->pan, &bufL[i], &bufR[i], batch);
+
+#ifdef SAVE_SAMPLE
+		for (s=0; s<batch; s++)
+		{
+			signed int outl = bufL[i + s], outr = bufR[i + s];
+
+			SAVE_ALL_CHANNELS
 		}
 #endif
-		advance(PSG);
 	}
 }
 
@@ -0,0 +1,94 @@
+// license:GPL-2.0+
+// copyright-holders:Jarek Burczynski
+/*****************************************************************************
+*
+*   Yamaha YM2151 channel mixer
+*
+*   Pans, sums and clamps a batch of channel outputs down to left and
+*   right, four samples at a time with SSE2 where it is available.
+*
+******************************************************************************/
+
+#pragma once
+
+#ifndef __YM2151MIX_H__
+#define __YM2151MIX_H__
+
+/* use SSE2 on 64-bit implementations, where it can be assumed */
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define YM2151_USE_SSE2 1
+#include <emmintrin.h>
+#else
+#define YM2151_USE_SSE2 0
+#endif
+
+/*  'chanout' holds 8 channels of 'stride' samples each, 'pan' a left and
+*   right mask (0 or ~0) per channel; samples 'start' to 'length'-1 are
+*   mixed into 'bufL' and 'bufR' one at a time
+*/
+template<int _FinalShift, int _MinOut, int _MaxOut>
+static inline void ym2151_mix_scalar(const INT32 *chanout, int stride, const UINT32 *pan, INT32 *bufL, INT32 *bufR, int start, int length)
+{
+	for (int s = start; s < length; s++)
+	{
+		signed int outl = 0, outr = 0;
+
+		for (int chan = 0; chan < 8; chan++)
+		{
+			outl += (chanout[chan * stride + s] & pan[chan*2+0]);
+			outr += (chanout[chan * stride + s] & pan[chan*2+1]);
+		}
+
+		outl >>= _FinalShift;
+		outr >>= _FinalShift;
+		if (outl > _MaxOut) outl = _MaxOut;
+			else if (outl < _MinOut) outl = _MinOut;
+		if (outr > _MaxOut) outr = _MaxOut;
+			else if (outr < _MinOut) outr = _MinOut;
+		bufL[s] = outl;
+		bufR[s] = outr;
+	}
+}
+
+/* the same for samples 0 to 'length'-1, giving the same results */
+template<int _FinalShift, int _MinOut, int _MaxOut>
+static inline void ym2151_mix(const INT32 *chanout, int stride, const UINT32 *pan, INT32 *bufL, INT32 *bufR, int length)
+{
+	int s = 0;
+#if YM2151_USE_SSE2
+	const __m128i maxout = _mm_set1_epi32(_MaxOut);
+	const __m128i minout = _mm_set1_epi32(_MinOut);
+
+	for ( ; s + 4 <= length; s += 4)
+	{
+		__m128i outl = _mm_setzero_si128();
+		__m128i outr = _mm_setzero_si128();
+		__m128i mask;
+
+		for (int chan = 0; chan < 8; chan++)
+		{
+			__m128i co = _mm_loadu_si128((const __m128i *)&chanout[chan * stride + s]);
+			outl = _mm_add_epi32(outl, _mm_and_si128(co, _mm_set1_epi32(pan[chan*2+0])));
+			outr = _mm_add_epi32(outr, _mm_and_si128(co, _mm_set1_epi32(pan[chan*2+1])));
+		}
+
+		outl = _mm_srai_epi32(outl, _FinalShift);
+		outr = _mm_srai_epi32(outr, _FinalShift);
+
+		mask = _mm_cmpgt_epi32(outl, maxout);
+		outl = _mm_or_si128(_mm_and_si128(mask, maxout), _mm_andnot_si128(mask, outl));
+		mask = _mm_cmplt_epi32(outl, minout);
+		outl = _mm_or_si128(_mm_and_si128(mask, minout), _mm_andnot_si128(mask, outl));
+		mask = _mm_cmpgt_epi32(outr, maxout);
+		outr = _mm_or_si128(_mm_and_si128(mask, maxout), _mm_andnot_si128(mask, outr));
+		mask = _mm_cmplt_epi32(outr, minout);
+		outr = _mm_or_si128(_mm_and_si128(mask, minout), _mm_andnot_si128(mask, outr));
+
+		_mm_storeu_si128((__m128i *)&bufL[s], outl);
+		_mm_storeu_si128((__m128i *)&bufR[s], outr);
+	}
+#endif
+	ym2151_mix_scalar<_FinalShift, _MinOut, _MaxOut>(chanout, stride, pan, bufL, bufR, s, length);
+}
+
+#endif  /* __YM2151MIX_H__ */
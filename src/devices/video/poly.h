@@ -68,6 +68,11 @@
 #define TOTAL_BUCKETS                       (512 / SCANLINES_PER_BUCKET)
 #define UNITS_PER_POLY                      (100 / SCANLINES_PER_BUCKET)
 
+// new work units are held back and queued together once this many pixels or
+// units are waiting; a bucket's waiting units are chained into a single item
+#define POLY_BATCH_PIXELS                   4096
+#define POLY_BATCH_UNITS                    64
+
 
 
 //**************************************************************************
@@ -154,6 +159,9 @@ public:
 	// public helpers
 	int zclip_if_less(int numverts, const vertex_t *v, vertex_t *outv, int paramcount, _BaseType clipval);
 
+	// statistics report, for tuning
+	std::string statistics() const;
+
 private:
 	// polygon_info describes a single polygon, which includes the poly_params
 	struct polygon_info
@@ -237,6 +245,38 @@ private:
 	}
 
 	// internal helpers
+	work_unit &unit_alloc(polygon_info &polygon, INT32 scanline, INT32 count)
+	{
+		UINT32 bucketnum = ((UINT32)scanline / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		UINT32 unit_index = m_unit.count();
+		work_unit &unit = m_unit.next();
+
+		// fill in the work unit basics
+		unit.polygon = &polygon;
+		unit.count_next = count;
+		unit.scanline = scanline;
+		unit.previtem = m_unit_bucket[bucketnum];
+		m_unit_bucket[bucketnum] = unit_index;
+
+		// chain onto the bucket's last unqueued unit, which can't be running
+		// yet; otherwise start a new item
+		if (m_batch_bucket[bucketnum] != 0xffff)
+			m_unit[m_batch_bucket[bucketnum]].count_next |= unit_index << 16;
+		else
+			m_batch_head[m_batch_heads++] = &unit;
+		m_batch_bucket[bucketnum] = unit_index;
+		m_units++;
+		return unit;
+	}
+
+	void unit_ready(INT32 pixels)
+	{
+		// queue the held back units once there's enough work for a batch
+		m_batch_pixels += pixels;
+		if (m_batch_pixels >= POLY_BATCH_PIXELS || m_unit.count() - m_batch_start >= POLY_BATCH_UNITS)
+			flush();
+	}
+
 	polygon_info &polygon_alloc(int minx, int maxx, int miny, int maxy, render_delegate callback)
 	{
 		// wait for space in the polygon and unit arrays
@@ -251,7 +291,9 @@ private:
 		return polygon;
 	}
 
+	void flush();
 	static void *work_item_callback(void *param, int threadid);
+	static void *batch_item_callback(void *param, int threadid) { return work_item_callback(*(work_unit **)param, threadid); }
 	void presave() { wait("pre-save"); }
 
 	// queue management
@@ -270,14 +312,27 @@ private:
 	// buckets
 	UINT16              m_unit_bucket[TOTAL_BUCKETS]; // buckets for tracking unit usage
 
+	// batching
+	UINT16              m_batch_bucket[TOTAL_BUCKETS]; // last unqueued unit in each bucket
+	std::vector<work_unit *> m_batch_head;          // first unit of each item, in queueing order
+	UINT32              m_batch_heads;              // number of entries in m_batch_head
+	UINT32              m_batch_queued;             // number of those already queued
+	UINT32              m_batch_start;              // first unqueued unit
+	INT32               m_batch_pixels;             // pixels in the unqueued units
+
 	// statistics
 	UINT32              m_tiles;                    // number of tiles queued
 	UINT32              m_triangles;                // number of triangles queued
 	UINT32              m_quads;                    // number of quads queued
 	UINT64              m_pixels;                   // number of pixels rendered
+	UINT32              m_units;                    // number of work units created
+	UINT32              m_items;                    // number of work items queued
+	UINT32              m_batches;                  // number of batches queued
 #if KEEP_POLY_STATISTICS
 	UINT32              m_conflicts[WORK_MAX_THREADS]; // number of conflicts found, per thread
 	UINT32              m_resolved[WORK_MAX_THREADS];   // number of conflicts resolved, per thread
+	UINT32              m_thread_units[WORK_MAX_THREADS]; // number of units processed, per thread
+	UINT32              m_thread_scanlines[WORK_MAX_THREADS]; // number of scanlines processed, per thread
 #endif
 };
 
@@ -295,13 +350,26 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(runnin
 		m_object(machine, *this),
 		m_unit(machine, *this),
 		m_flags(flags),
+		m_batch_head(m_unit.allocated()),
+		m_batch_heads(0),
+		m_batch_queued(0),
+		m_batch_start(0),
+		m_batch_pixels(0),
+		m_tiles(0),
 		m_triangles(0),
 		m_quads(0),
-		m_pixels(0)
+		m_pixels(0),
+		m_units(0),
+		m_items(0),
+		m_batches(0)
 {
+	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+	memset(m_batch_bucket, 0xff, sizeof(m_batch_bucket));
 #if KEEP_POLY_STATISTICS
 	memset(m_conflicts, 0, sizeof(m_conflicts));
 	memset(m_resolved, 0, sizeof(m_resolved));
+	memset(m_thread_units, 0, sizeof(m_thread_units));
+	memset(m_thread_scanlines, 0, sizeof(m_thread_scanlines));
 #endif
 
 	// create the work queue
@@ -322,13 +390,26 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(screen
 		m_object(screen.machine(), *this),
 		m_unit(screen.machine(), *this),
 		m_flags(flags),
+		m_batch_head(m_unit.allocated()),
+		m_batch_heads(0),
+		m_batch_queued(0),
+		m_batch_start(0),
+		m_batch_pixels(0),
+		m_tiles(0),
 		m_triangles(0),
 		m_quads(0),
-		m_pixels(0)
+		m_pixels(0),
+		m_units(0),
+		m_items(0),
+		m_batches(0)
 {
+	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+	memset(m_batch_bucket, 0xff, sizeof(m_batch_bucket));
 #if KEEP_POLY_STATISTICS
 	memset(m_conflicts, 0, sizeof(m_conflicts));
 	memset(m_resolved, 0, sizeof(m_resolved));
+	memset(m_thread_units, 0, sizeof(m_thread_units));
+	memset(m_thread_scanlines, 0, sizeof(m_thread_scanlines));
 #endif
 
 	// create the work queue
@@ -348,7 +429,40 @@ template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::~poly_manager()
 {
 #if KEEP_POLY_STATISTICS
+	printf("%s", statistics().c_str());
+#endif
+
+	// free the work queue
+	if (m_queue != nullptr)
+		osd_work_queue_free(m_queue);
+}
+
+
+//-------------------------------------------------
+//  statistics - return a report of the work done
+//  so far and how it was split up
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+std::string poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::statistics() const
 {
+	std::string result;
+
+	// output global stats
+	result += string_format("Total tiles     = %d\n", m_tiles);
+	result += string_format("Total triangles = %d\n", m_triangles);
+	result += string_format("Total quads     = %d\n", m_quads);
+	if (m_pixels > 1000000000)
+		result += string_format("Total pixels    = %d%09d\n", (UINT32)(m_pixels / 1000000000), (UINT32)(m_pixels % 1000000000));
+	else
+		result += string_format("Total pixels    = %d\n", (UINT32)m_pixels);
+
+	// how the work was batched
+	result += string_format("Batching:    %d units in %d items, %d batches (%.1f units/item, %.1f items/batch)\n",
+			m_units, m_items, m_batches,
+			m_items ? (double)m_units / m_items : 0.0, m_batches ? (double)m_items / m_batches : 0.0);
+
+#if KEEP_POLY_STATISTICS
 	// accumulate stats over the entire collection
 	int conflicts = 0, resolved = 0;
 	for (int i = 0; i < ARRAY_LENGTH(m_conflicts); i++)
@@ -356,25 +470,41 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::~poly_manager()
 		conflicts += m_conflicts[i];
 		resolved += m_resolved[i];
 	}
+	result += string_format("Conflicts:   %d resolved, %d total\n", resolved, conflicts);
 
-	// output global stats
-	printf("Total triangles = %d\n", m_triangles);
-	printf("Total quads = %d\n", m_quads);
-	if (m_pixels > 1000000000)
-		printf("Total pixels   = %d%09d\n", (UINT32)(m_pixels / 1000000000), (UINT32)(m_pixels % 1000000000));
-	else
-		printf("Total pixels   = %d\n", (UINT32)m_pixels);
+	// per-thread stats
+	for (int i = 0; i < ARRAY_LENGTH(m_thread_units); i++)
+		if (m_thread_units[i] != 0)
+			result += string_format("Thread %2d:   %9d units, %9d scanlines, %7d conflicts\n", i, m_thread_units[i], m_thread_scanlines[i], m_conflicts[i]);
+#endif
 
-	printf("Conflicts:   %d resolved, %d total\n", resolved, conflicts);
-	printf("Units:       %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_unit.max(), m_unit.allocated(), m_unit.waits(), m_unit.itemsize(), m_unit.allocated() * m_unit.itemsize());
-	printf("Polygons:    %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_polygon.max(), m_polygon.allocated(), m_polygon.waits(), m_polygon.itemsize(), m_polygon.allocated() * m_polygon.itemsize());
-	printf("Object data: %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_object.max(), m_object.allocated(), m_object.waits(), m_object.itemsize(), m_object.allocated() * m_object.itemsize());
+	result += string_format("Units:       %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_unit.max(), m_unit.allocated(), m_unit.waits(), m_unit.itemsize(), m_unit.allocated() * m_unit.itemsize());
+	result += string_format("Polygons:    %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_polygon.max(), m_polygon.allocated(), m_polygon.waits(), m_polygon.itemsize(), m_polygon.allocated() * m_polygon.itemsize());
+	result += string_format("Object data: %5d used, %5d allocated, %5d waits, %4d bytes each, %7d total\n", m_object.max(), m_object.allocated(), m_object.waits(), m_object.itemsize(), m_object.allocated() * m_object.itemsize());
+	return result;
 }
-#endif
 
-	// free the work queue
-	if (m_queue != nullptr)
-		osd_work_queue_free(m_queue);
+
+//-------------------------------------------------
+//  flush - queue the units held back for
+//  batching, one item per bucket
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::flush()
+{
+	if (m_queue != nullptr && m_batch_heads > m_batch_queued)
+	{
+		osd_work_item_queue_multiple(m_queue, batch_item_callback, m_batch_heads - m_batch_queued, &m_batch_head[m_batch_queued], sizeof(m_batch_head[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		m_items += m_batch_heads - m_batch_queued;
+		m_batches++;
+	}
+
+	// later units start new chains
+	m_batch_queued = m_batch_heads;
+	m_batch_start = m_unit.count();
+	m_batch_pixels = 0;
+	memset(m_batch_bucket, 0xff, sizeof(m_batch_bucket));
 }
 
 
@@ -424,6 +554,11 @@ void *poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::work_item_cal
 		for (int curscan = 0; curscan < count; curscan++)
 			polygon.m_callback(unit.scanline + curscan, unit.extent[curscan], *polygon.m_object, threadid);
 
+#if KEEP_POLY_STATISTICS
+		polygon.m_owner->m_thread_units[threadid]++;
+		polygon.m_owner->m_thread_scanlines[threadid] += count;
+#endif
+
 		// set our count to 0 and re-fetch the original count value
 		do
 		{
@@ -453,7 +588,8 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 	if (LOG_WAITS)
 		time = get_profile_ticks();
 
-	// wait for all pending work items to complete
+	// queue anything held back, then wait for all pending work items to complete
+	flush();
 	if (m_queue != nullptr)
 		osd_work_queue_wait(m_queue, osd_ticks_per_second() * 100);
 
@@ -474,6 +610,7 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 	m_polygon.reset();
 	m_unit.reset();
 	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+	m_batch_heads = m_batch_queued = m_batch_start = 0;
 
 	// we need to preserve the last object data that was supplied
 	if (m_object.count() > 0)
@@ -579,26 +716,19 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tile(
 
 	// compute the X extents for each scanline
 	INT32 pixels = 0;
-	UINT32 startunit = m_unit.count();
 	INT32 scaninc = 1;
 	for (INT32 curscan = v1yclip; curscan < v2yclip; curscan += scaninc)
 	{
-		UINT32 bucketnum = ((UINT32)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
-		UINT32 unit_index = m_unit.count();
-		work_unit &unit = m_unit.next();
-
 		// determine how much to advance to hit the next bucket
 		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
 
-		// fill in the work unit basics
-		unit.polygon = &polygon;
-		unit.count_next = MIN(v2yclip - curscan, scaninc);
-		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		// allocate a work unit for the scanlines up to there
+		INT32 count = MIN(v2yclip - curscan, scaninc);
+		work_unit &unit = unit_alloc(polygon, curscan, count);
+		INT32 startpixels = pixels;
 
 		// iterate over extents
-		for (int extnum = 0; extnum < unit.count_next; extnum++)
+		for (int extnum = 0; extnum < count; extnum++)
 		{
 			// compute the ending X based on which part of the triangle we're in
 			_BaseType fully = _BaseType(curscan + extnum) + _BaseType(0.5);
@@ -618,11 +748,10 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tile(
 				extent.param[paramnum].dpdx = param_dpdx[paramnum];
 			}
 		}
-	}
 
-	// enqueue the work items
-	if (m_queue != nullptr)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+		// hand the unit to the workers once enough has built up
+		unit_ready(pixels - startpixels);
+	}
 
 	// return the total number of pixels in the triangle
 	m_tiles++;
@@ -737,26 +866,19 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 
 	// compute the X extents for each scanline
 	INT32 pixels = 0;
-	UINT32 startunit = m_unit.count();
 	INT32 scaninc = 1;
 	for (INT32 curscan = v1yclip; curscan < v3yclip; curscan += scaninc)
 	{
-		UINT32 bucketnum = ((UINT32)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
-		UINT32 unit_index = m_unit.count();
-		work_unit &unit = m_unit.next();
-
 		// determine how much to advance to hit the next bucket
 		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
 
-		// fill in the work unit basics
-		unit.polygon = &polygon;
-		unit.count_next = MIN(v3yclip - curscan, scaninc);
-		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		// allocate a work unit for the scanlines up to there
+		INT32 count = MIN(v3yclip - curscan, scaninc);
+		work_unit &unit = unit_alloc(polygon, curscan, count);
+		INT32 startpixels = pixels;
 
 		// iterate over extents
-		for (int extnum = 0; extnum < unit.count_next; extnum++)
+		for (int extnum = 0; extnum < count; extnum++)
 		{
 			// compute the ending X based on which part of the triangle we're in
 			_BaseType fully = _BaseType(curscan + extnum) + _BaseType(0.5);
@@ -806,11 +928,10 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 				extent.param[paramnum].dpdx = param_dpdx[paramnum];
 			}
 		}
-	}
 
-	// enqueue the work items
-	if (m_queue != nullptr)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+		// hand the unit to the workers once enough has built up
+		unit_ready(pixels - startpixels);
+	}
 
 	// return the total number of pixels in the triangle
 	m_triangles++;
@@ -870,26 +991,19 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 
 	// compute the X extents for each scanline
 	INT32 pixels = 0;
-	UINT32 startunit = m_unit.count();
 	INT32 scaninc = 1;
 	for (INT32 curscan = v1yclip; curscan < v3yclip; curscan += scaninc)
 	{
-		UINT32 bucketnum = ((UINT32)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
-		UINT32 unit_index = m_unit.count();
-		work_unit &unit = m_unit.next();
-
 		// determine how much to advance to hit the next bucket
 		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
 
-		// fill in the work unit basics
-		unit.polygon = &polygon;
-		unit.count_next = MIN(v3yclip - curscan, scaninc);
-		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		// allocate a work unit for the scanlines up to there
+		INT32 count = MIN(v3yclip - curscan, scaninc);
+		work_unit &unit = unit_alloc(polygon, curscan, count);
+		INT32 startpixels = pixels;
 
 		// iterate over extents
-		for (int extnum = 0; extnum < unit.count_next; extnum++)
+		for (int extnum = 0; extnum < count; extnum++)
 		{
 			const extent_t &srcextent = extents[(curscan + extnum) - startscanline];
 			INT32 istartx = srcextent.startx, istopx = srcextent.stopx;
@@ -922,11 +1036,10 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 			else if(istopx < istartx)
 				pixels += istartx - istopx;
 		}
-	}
 
-	// enqueue the work items
-	if (m_queue != nullptr)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+		// hand the unit to the workers once enough has built up
+		unit_ready(pixels - startpixels);
+	}
 
 	// return the total number of pixels in the object
 	m_triangles++;
@@ -1045,26 +1158,19 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_polyg
 
 	// compute the X extents for each scanline
 	INT32 pixels = 0;
-	UINT32 startunit = m_unit.count();
 	INT32 scaninc = 1;
 	for (INT32 curscan = minyclip; curscan < maxyclip; curscan += scaninc)
 	{
-		UINT32 bucketnum = ((UINT32)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
-		UINT32 unit_index = m_unit.count();
-		work_unit &unit = m_unit.next();
-
 		// determine how much to advance to hit the next bucket
 		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
 
-		// fill in the work unit basics
-		unit.polygon = &polygon;
-		unit.count_next = MIN(maxyclip - curscan, scaninc);
-		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		// allocate a work unit for the scanlines up to there
+		INT32 count = MIN(maxyclip - curscan, scaninc);
+		work_unit &unit = unit_alloc(polygon, curscan, count);
+		INT32 startpixels = pixels;
 
 		// iterate over extents
-		for (int extnum = 0; extnum < unit.count_next; extnum++)
+		for (int extnum = 0; extnum < count; extnum++)
 		{
 			// compute the ending X based on which part of the triangle we're in
 			_BaseType fully = _BaseType(curscan + extnum) + _BaseType(0.5);
@@ -1121,11 +1227,10 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_polyg
 			extent.userdata = nullptr;
 			pixels += istopx - istartx;
 		}
-	}
 
-	// enqueue the work items
-	if (m_queue != nullptr)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+		// hand the unit to the workers once enough has built up
+		unit_ready(pixels - startpixels);
+	}
 
 	// return the total number of pixels in the triangle
 	m_quads++;
@@ -14,6 +14,14 @@
 
 #define VERBOSE_LEVEL ( 0 )
 
+/* use SSE2 on 64-bit implementations, where it can be assumed */
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define PSXGPU_USE_SSE2 ( 1 )
+#include <emmintrin.h>
+#else
+#define PSXGPU_USE_SSE2 ( 0 )
+#endif
+
 // device type definition
 const device_type CXD8514Q = &device_creator<cxd8514q_device>;
 const device_type CXD8538Q = &device_creator<cxd8538q_device>;
@@ -24,6 +32,13 @@ const device_type CXD8654Q = &device_creator<cxd8654q_device>;
 
 psxgpu_device::psxgpu_device(const machine_config &mconfig, device_type type, const char *name, const char *tag, device_t *owner, UINT32 clock, const char *shortname, const char *source) :
 	device_t(mconfig, type, name, tag, owner, clock, shortname, source),
+	m_threaded(false),
+	m_gp0_queue(nullptr),
+	m_gp0_request(nullptr),
+	m_gp0_fill(0),
+	m_gp0_report(0),
+	m_gp0_unknown_packet(0),
+	m_gp0_unknown_data(0),
 	m_vblank_handler(*this)
 #if DEBUG_VIEWER
 ,
@@ -44,13 +59,32 @@ void psxgpu_device::device_start( void )
 	{
 		psx_gpu_init( 2 );
 	}
+
+	/* the debug viewer draws from inside the primitives, so keep those on this thread */
+	if( m_threaded && !DEBUG_VIEWER )
+	{
+		m_gp0_queue = osd_work_queue_alloc( WORK_QUEUE_FLAG_HIGH_FREQ );
+		m_gp0_fifo[ 0 ].reserve( GP0_FIFO_WORDS );
+		m_gp0_fifo[ 1 ].reserve( GP0_FIFO_WORDS );
+	}
 }
 
 void psxgpu_device::device_reset( void )
 {
+	gp0_sync();
 	gpu_reset();
 }
 
+void psxgpu_device::device_stop( void )
+{
+	if( m_gp0_queue != nullptr )
+	{
+		gp0_discard();
+		osd_work_queue_free( m_gp0_queue );
+		m_gp0_queue = nullptr;
+	}
+}
+
 cxd8514q_device::cxd8514q_device(const machine_config &mconfig, const char *tag, device_t *owner, UINT32 clock)
 	: psxgpu_device(mconfig, CXD8514Q, "CXD8514Q GPU", tag, owner, clock, "cxd8514q", __FILE__)
 {
@@ -590,7 +624,7 @@ void psxgpu_device::psx_gpu_init( int n_gputype )
 	save_item(NAME(n_drawoffset_y));
 	save_item(NAME(m_n_displaystartx));
 	save_item(NAME(n_displaystarty));
-	save_item(NAME(n_gpustatus));
+	save_item(NAME(n_gpustatus_state));
 	save_item(NAME(n_gpuinfo));
 	save_item(NAME(n_lightgun_x));
 	save_item(NAME(n_lightgun_y));
@@ -602,7 +636,8 @@ void psxgpu_device::psx_gpu_init( int n_gputype )
 	save_item(NAME(n_iy));
 	save_item(NAME(n_ti));
 
-	machine().save().register_postload( save_prepost_delegate( FUNC( psxgpu_device::updatevisiblearea ), this ) );
+	machine().save().register_presave( save_prepost_delegate( FUNC( psxgpu_device::gp0_presave ), this ) );
+	machine().save().register_postload( save_prepost_delegate( FUNC( psxgpu_device::gp0_postload ), this ) );
 }
 
 UINT32 psxgpu_device::update_screen(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect)
@@ -619,6 +654,8 @@ UINT32 psxgpu_device::update_screen(screen_device &screen, bitmap_ind16 &bitmap,
 	int n_overscantop;
 	int n_overscanleft;
 
+	gp0_sync();
+
 #if DEBUG_VIEWER
 	if( DebugMeshDisplay( bitmap, cliprect ) )
 	{
@@ -794,7 +831,7 @@ void psxgpu_device::decode_tpage( UINT32 tpage )
 		}
 		if( n_tp == 3 )
 		{
-			verboselog( *this, 0, "not handled: tp == 3\n" );
+			m_gp0_report |= GP0_REPORT_TP3;
 		}
 	}
 	else
@@ -814,11 +851,11 @@ void psxgpu_device::decode_tpage( UINT32 tpage )
 		}
 		if( n_tp == 3 )
 		{
-			verboselog( *this, 0, "not handled: tp == 3\n" );
+			m_gp0_report |= GP0_REPORT_TP3;
 		}
 		else if( n_tp == 2 && n_ti != 0 )
 		{
-			verboselog( *this, 0, "not handled: interleaved 15 bit texture\n" );
+			m_gp0_report |= GP0_REPORT_INTERLEAVED_15BIT;
 		}
 	}
 }
@@ -902,6 +939,13 @@ void psxgpu_device::decode_tpage( UINT32 tpage )
 #define SOLIDSETUP \
 	TRANSPARENCYSETUP
 
+#if PSXGPU_USE_SSE2
+/* psx_draw_span blends textured spans itself, the tables are only for SOLIDFILL */
+#define TEXTURETRANSPARENCYSETUP
+#else
+#define TEXTURETRANSPARENCYSETUP TRANSPARENCYSETUP
+#endif
+
 #define TEXTURESETUP \
 	n_tx = m_n_tx; \
 	n_ty = m_n_ty; \
@@ -921,7 +965,7 @@ void psxgpu_device::decode_tpage( UINT32 tpage )
 		n_ty += n_twy; \
 		break; \
 	} \
-	TRANSPARENCYSETUP
+	TEXTURETRANSPARENCYSETUP
 
 #define FLATPOLYGONUPDATE
 #define FLATRECTANGEUPDATE
@@ -967,6 +1011,135 @@ void psxgpu_device::decode_tpage( UINT32 tpage )
 		break; \
 	}
 
+#if PSXGPU_USE_SSE2
+
+/*
+textured spans are fetched a texel at a time and then shaded/blended in
+blocks, eight pixels per vector. results match the lookup tables exactly:
+each channel is min( 31, ( level * shade ) >> 7 ), semi transparent texels
+blend that against the background as selected by abr, and texel 0 leaves
+the background untouched.
+*/
+
+#define PSX_SPAN_PIXELS ( 64 )
+
+static inline int psx_span_blend( int n_b, int n_f, int n_abr )
+{
+	switch( n_abr )
+	{
+	case 0x00:
+		return std::min( ( n_b >> 1 ) + std::min( n_f >> 1, 31 ), 31 );
+	case 0x01:
+		return std::min( n_b + std::min( n_f, 31 ), 31 );
+	case 0x02:
+		return std::max( n_b - std::min( n_f, 31 ), 0 );
+	default:
+		return std::min( n_b + std::min( n_f >> 2, 31 ), 31 );
+	}
+}
+
+static inline __m128i psx_span_blend( __m128i n_b, __m128i n_f, int n_abr, __m128i n_max )
+{
+	switch( n_abr )
+	{
+	case 0x00:
+		return _mm_min_epi16( _mm_add_epi16( _mm_srli_epi16( n_b, 1 ), _mm_min_epi16( _mm_srli_epi16( n_f, 1 ), n_max ) ), n_max );
+	case 0x01:
+		return _mm_min_epi16( _mm_add_epi16( n_b, _mm_min_epi16( n_f, n_max ) ), n_max );
+	case 0x02:
+		return _mm_subs_epu16( n_b, _mm_min_epi16( n_f, n_max ) );
+	default:
+		return _mm_min_epi16( _mm_add_epi16( n_b, _mm_min_epi16( _mm_srli_epi16( n_f, 2 ), n_max ) ), n_max );
+	}
+}
+
+/*
+true when texels or clut entries can be fetched from the destination row
+(vram to vram feedback). the span is then flushed every pixel, so each
+write lands before the next fetch just as it does without batching.
+*/
+static inline bool psx_span_aliases( UINT16 *const *p_p_vram, int n_height, int n_dsty, int n_ty, const UINT16 *p_clut )
+{
+	const UINT16 *p_n_row = p_p_vram[ n_dsty ];
+
+	/* a clut is up to 256 entries and may run on into the next row */
+	if( p_clut < p_n_row + 1024 && p_clut + 256 > p_n_row )
+	{
+		return true;
+	}
+
+	/* texels come from the 256 rows below n_ty, plus one for fetches running off the end of a row */
+	int n_row = ( p_n_row - p_p_vram[ 0 ] ) >> 10;
+	int n_texrow = ( p_p_vram[ n_ty ] - p_p_vram[ 0 ] ) >> 10;
+	return n_height <= 257 || ( ( n_row - n_texrow + n_height ) % n_height ) <= 256;
+}
+
+/* n_abr is the transparency mode, or -1 when semi transparency is off */
+static void psx_draw_span( UINT16 *p_vram, const UINT16 *p_n_bgr, const UINT16 *p_n_r, const UINT16 *p_n_g, const UINT16 *p_n_b, int n_count, int n_abr )
+{
+	const __m128i n_max = _mm_set1_epi16( 31 );
+	const __m128i n_zero = _mm_setzero_si128();
+	int n_x = 0;
+
+	for( ; n_x + 8 <= n_count; n_x += 8 )
+	{
+		__m128i n_bgr = _mm_loadu_si128( (const __m128i *)&p_n_bgr[ n_x ] );
+		__m128i n_dst = _mm_loadu_si128( (const __m128i *)&p_vram[ n_x ] );
+
+		/* level * shade fits in 13 bits, so 16 bit lanes are enough */
+		__m128i n_r = _mm_srli_epi16( _mm_mullo_epi16( _mm_and_si128( n_bgr, n_max ), _mm_loadu_si128( (const __m128i *)&p_n_r[ n_x ] ) ), 7 );
+		__m128i n_g = _mm_srli_epi16( _mm_mullo_epi16( _mm_and_si128( _mm_srli_epi16( n_bgr, 5 ), n_max ), _mm_loadu_si128( (const __m128i *)&p_n_g[ n_x ] ) ), 7 );
+		__m128i n_b = _mm_srli_epi16( _mm_mullo_epi16( _mm_and_si128( _mm_srli_epi16( n_bgr, 10 ), n_max ), _mm_loadu_si128( (const __m128i *)&p_n_b[ n_x ] ) ), 7 );
+
+		__m128i n_out = _mm_or_si128( _mm_min_epi16( n_r, n_max ),
+			_mm_or_si128( _mm_slli_epi16( _mm_min_epi16( n_g, n_max ), 5 ), _mm_slli_epi16( _mm_min_epi16( n_b, n_max ), 10 ) ) );
+
+		if( n_abr >= 0 )
+		{
+			__m128i n_semi = _mm_srai_epi16( n_bgr, 15 );
+			if( _mm_movemask_epi8( n_semi ) != 0 )
+			{
+				__m128i n_trans = _mm_or_si128( psx_span_blend( _mm_and_si128( n_dst, n_max ), n_r, n_abr, n_max ),
+					_mm_or_si128( _mm_slli_epi16( psx_span_blend( _mm_and_si128( _mm_srli_epi16( n_dst, 5 ), n_max ), n_g, n_abr, n_max ), 5 ),
+						_mm_slli_epi16( psx_span_blend( _mm_and_si128( _mm_srli_epi16( n_dst, 10 ), n_max ), n_b, n_abr, n_max ), 10 ) ) );
+				n_out = _mm_or_si128( _mm_and_si128( n_semi, n_trans ), _mm_andnot_si128( n_semi, n_out ) );
+			}
+		}
+
+		__m128i n_skip = _mm_cmpeq_epi16( n_bgr, n_zero );
+		_mm_storeu_si128( (__m128i *)&p_vram[ n_x ], _mm_or_si128( _mm_and_si128( n_skip, n_dst ), _mm_andnot_si128( n_skip, n_out ) ) );
+	}
+
+	for( ; n_x < n_count; n_x++ )
+	{
+		int n_bgr = p_n_bgr[ n_x ];
+		if( n_bgr != 0 )
+		{
+			int n_r = ( ( n_bgr & 31 ) * p_n_r[ n_x ] ) >> 7;
+			int n_g = ( ( ( n_bgr >> 5 ) & 31 ) * p_n_g[ n_x ] ) >> 7;
+			int n_b = ( ( ( n_bgr >> 10 ) & 31 ) * p_n_b[ n_x ] ) >> 7;
+
+			if( n_abr >= 0 && ( n_bgr & 0x8000 ) != 0 )
+			{
+				int n_dst = p_vram[ n_x ];
+				n_r = psx_span_blend( n_dst & 31, n_r, n_abr );
+				n_g = psx_span_blend( ( n_dst >> 5 ) & 31, n_g, n_abr );
+				n_b = psx_span_blend( ( n_dst >> 10 ) & 31, n_b, n_abr );
+			}
+			else
+			{
+				n_r = std::min( n_r, 31 );
+				n_g = std::min( n_g, 31 );
+				n_b = std::min( n_b, 31 );
+			}
+
+			p_vram[ n_x ] = n_r | ( n_g << 5 ) | ( n_b << 10 );
+		}
+	}
+}
+
+#endif
+
 #define FLATTEXTUREDPOLYGONUPDATE \
 	n_u.d += n_du; \
 	n_v.d += n_dv;
@@ -1061,7 +1234,54 @@ void psxgpu_device::decode_tpage( UINT32 tpage )
 		n_distance--; \
 	TEXTURE_ENDLOOP
 
+#if PSXGPU_USE_SSE2
+
+/* texels are gathered into a span and drawn by psx_draw_span */
+#define SPANPIXEL( PIXELUPDATE ) \
+		p_n_spanbgr[ n_span ] = n_bgr; \
+		p_n_spanr[ n_span ] = n_r.w.h; \
+		p_n_spang[ n_span ] = n_g.w.h; \
+		p_n_spanb[ n_span ] = n_b.w.h; \
+		if( ++n_span == n_spanlimit ) \
+		{ \
+			psx_draw_span( p_vram, p_n_spanbgr, p_n_spanr, p_n_spang, p_n_spanb, n_span, n_spanabr ); \
+			p_vram += n_span; \
+			n_span = 0; \
+		} \
+		PIXELUPDATE \
+		n_distance--; \
+	TEXTURE_ENDLOOP
+
+#undef SHADEDPIXEL
+#undef TRANSPARENTPIXEL
+#define SHADEDPIXEL( PIXELUPDATE ) SPANPIXEL( PIXELUPDATE )
+#define TRANSPARENTPIXEL( PIXELUPDATE ) SPANPIXEL( PIXELUPDATE )
+
 #define TEXTUREFILL( PIXELUPDATE, TXU, TXV ) \
+	{ \
+		UINT16 p_n_spanbgr[ PSX_SPAN_PIXELS ]; \
+		UINT16 p_n_spanr[ PSX_SPAN_PIXELS ]; \
+		UINT16 p_n_spang[ PSX_SPAN_PIXELS ]; \
+		UINT16 p_n_spanb[ PSX_SPAN_PIXELS ]; \
+		int n_span = 0; \
+		int n_spanabr = ( n_cmd & 0x02 ) != 0 ? (int)n_abr : -1; \
+		int n_spanlimit = psx_span_aliases( p_p_vram, vramSize / 2048, drawy, n_ty, p_clut ) ? 1 : PSX_SPAN_PIXELS; \
+		\
+		TEXTURESPAN( PIXELUPDATE, TXU, TXV ) \
+		\
+		if( n_span != 0 ) \
+		{ \
+			psx_draw_span( p_vram, p_n_spanbgr, p_n_spanr, p_n_spang, p_n_spanb, n_span, n_spanabr ); \
+		} \
+	}
+
+#else
+
+#define TEXTUREFILL( PIXELUPDATE, TXU, TXV ) TEXTURESPAN( PIXELUPDATE, TXU, TXV )
+
+#endif
+
+#define TEXTURESPAN( PIXELUPDATE, TXU, TXV ) \
 	if( n_distance > ( (INT32)n_drawarea_x2 - drawx ) + 1 ) \
 	{ \
 		n_distance = ( n_drawarea_x2 - drawx ) + 1; \
@@ -1504,6 +1724,7 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	UINT32 n_clutx;
 	UINT32 n_cluty;
 
+#if !PSXGPU_USE_SSE2
 	UINT16 *p_n_f;
 	UINT16 *p_n_redb;
 	UINT16 *p_n_greenb;
@@ -1511,6 +1732,7 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	UINT16 *p_n_redtrans;
 	UINT16 *p_n_greentrans;
 	UINT16 *p_n_bluetrans;
+#endif
 
 	PAIR n_r;
 	PAIR n_g;
@@ -1899,6 +2121,7 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	UINT32 n_clutx;
 	UINT32 n_cluty;
 
+#if !PSXGPU_USE_SSE2
 	UINT16 *p_n_f;
 	UINT16 *p_n_redb;
 	UINT16 *p_n_greenb;
@@ -1906,6 +2129,7 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	UINT16 *p_n_redtrans;
 	UINT16 *p_n_greentrans;
 	UINT16 *p_n_bluetrans;
+#endif
 
 	PAIR n_r;
 	PAIR n_g;
@@ -2655,6 +2879,7 @@ void psxgpu_device::FlatTexturedRectangle( void )
 	UINT32 n_clutx;
 	UINT32 n_cluty;
 
+#if !PSXGPU_USE_SSE2
 	UINT16 *p_n_f;
 	UINT16 *p_n_redb;
 	UINT16 *p_n_greenb;
@@ -2662,6 +2887,7 @@ void psxgpu_device::FlatTexturedRectangle( void )
 	UINT16 *p_n_redtrans;
 	UINT16 *p_n_greentrans;
 	UINT16 *p_n_bluetrans;
+#endif
 
 	PAIR n_r;
 	PAIR n_g;
@@ -2758,6 +2984,7 @@ void psxgpu_device::Sprite8x8( void )
 	UINT32 n_clutx;
 	UINT32 n_cluty;
 
+#if !PSXGPU_USE_SSE2
 	UINT16 *p_n_f;
 	UINT16 *p_n_redb;
 	UINT16 *p_n_greenb;
@@ -2765,6 +2992,7 @@ void psxgpu_device::Sprite8x8( void )
 	UINT16 *p_n_redtrans;
 	UINT16 *p_n_greentrans;
 	UINT16 *p_n_bluetrans;
+#endif
 
 	PAIR n_r;
 	PAIR n_g;
@@ -2861,6 +3089,7 @@ void psxgpu_device::Sprite16x16( void )
 	UINT32 n_clutx;
 	UINT32 n_cluty;
 
+#if !PSXGPU_USE_SSE2
 	UINT16 *p_n_f;
 	UINT16 *p_n_redb;
 	UINT16 *p_n_greenb;
@@ -2868,6 +3097,7 @@ void psxgpu_device::Sprite16x16( void )
 	UINT16 *p_n_redtrans;
 	UINT16 *p_n_greentrans;
 	UINT16 *p_n_bluetrans;
+#endif
 
 	PAIR n_r;
 	PAIR n_g;
@@ -3037,7 +3267,136 @@ void psxgpu_device::MoveImage( void )
 
 void psxgpu_device::dma_write( UINT32 *p_n_psxram, UINT32 n_address, INT32 n_size )
 {
-	gpu_write( &p_n_psxram[ n_address / 4 ], n_size );
+	gp0_write( &p_n_psxram[ n_address / 4 ], n_size );
+}
+
+void psxgpu_device::gp0_write( UINT32 *p_ram, INT32 n_size )
+{
+	if( m_gp0_queue == nullptr )
+	{
+		gpu_write( p_ram, n_size );
+		gp0_report();
+		return;
+	}
+
+	std::vector<UINT32> &fifo = m_gp0_fifo[ m_gp0_fill ];
+	fifo.insert( fifo.end(), p_ram, p_ram + n_size );
+	if( fifo.size() >= GP0_BATCH_WORDS )
+	{
+		/* only stall once too much is waiting behind the worker */
+		gp0_kick( fifo.size() >= GP0_FIFO_WORDS );
+	}
+}
+
+/* start the worker on the words collected so far, unless it is busy and we're not told to wait for it */
+void psxgpu_device::gp0_kick( bool b_wait )
+{
+	if( m_gp0_request != nullptr )
+	{
+		if( !b_wait && !osd_work_item_wait( m_gp0_request, 0 ) )
+		{
+			return;
+		}
+		while( !osd_work_item_wait( m_gp0_request, osd_ticks_per_second() ) )
+		{
+		}
+		osd_work_item_release( m_gp0_request );
+		m_gp0_request = nullptr;
+		m_gp0_fifo[ m_gp0_fill ^ 1 ].clear();
+		gp0_report();
+	}
+
+	if( !m_gp0_fifo[ m_gp0_fill ].empty() )
+	{
+		m_gp0_fill ^= 1;
+		m_gp0_request = osd_work_item_queue( m_gp0_queue, gp0_callback, this, 0 );
+	}
+}
+
+/* finish every GP0 word written so far; called before anything outside the worker touches VRAM or drawing state */
+void psxgpu_device::gp0_sync()
+{
+	if( m_gp0_queue == nullptr )
+	{
+		return;
+	}
+
+	if( m_gp0_request != nullptr )
+	{
+		while( !osd_work_item_wait( m_gp0_request, osd_ticks_per_second() ) )
+		{
+		}
+		osd_work_item_release( m_gp0_request );
+		m_gp0_request = nullptr;
+		m_gp0_fifo[ m_gp0_fill ^ 1 ].clear();
+	}
+
+	std::vector<UINT32> &fifo = m_gp0_fifo[ m_gp0_fill ];
+	if( !fifo.empty() )
+	{
+		gpu_write( &fifo[ 0 ], fifo.size() );
+		fifo.clear();
+	}
+	gp0_report();
+}
+
+/* drop words that were written before a state load */
+void psxgpu_device::gp0_discard()
+{
+	if( m_gp0_request != nullptr )
+	{
+		while( !osd_work_item_wait( m_gp0_request, osd_ticks_per_second() ) )
+		{
+		}
+		osd_work_item_release( m_gp0_request );
+		m_gp0_request = nullptr;
+	}
+
+	m_gp0_fifo[ 0 ].clear();
+	m_gp0_fifo[ 1 ].clear();
+}
+
+/* log what GP0 commands couldn't handle; the worker only records it, as logging and popmessage belong to the emulation thread */
+void psxgpu_device::gp0_report()
+{
+	if( ( m_gp0_report & GP0_REPORT_TP3 ) != 0 )
+	{
+		verboselog( *this, 0, "not handled: tp == 3\n" );
+	}
+	if( ( m_gp0_report & GP0_REPORT_INTERLEAVED_15BIT ) != 0 )
+	{
+		verboselog( *this, 0, "not handled: interleaved 15 bit texture\n" );
+	}
+	if( ( m_gp0_report & GP0_REPORT_UNKNOWN_PACKET ) != 0 )
+	{
+#if defined( MAME_DEBUG )
+		popmessage( "unknown GPU packet %08x", m_gp0_unknown_packet );
+#endif
+		verboselog( *this, 0, "unknown GPU packet %08x (%08x)\n", m_gp0_unknown_packet, m_gp0_unknown_data );
+	}
+	m_gp0_report = 0;
+}
+
+void psxgpu_device::gp0_presave()
+{
+	gp0_sync();
+	n_gpustatus_state = n_gpustatus;
+}
+
+void psxgpu_device::gp0_postload()
+{
+	gp0_discard();
+	n_gpustatus = n_gpustatus_state;
+	updatevisiblearea();
+}
+
+void *psxgpu_device::gp0_callback( void *param, int threadid )
+{
+	psxgpu_device *gpu = (psxgpu_device *)param;
+	std::vector<UINT32> &fifo = gpu->m_gp0_fifo[ gpu->m_gp0_fill ^ 1 ];
+
+	gpu->gpu_write( &fifo[ 0 ], fifo.size() );
+	return nullptr;
 }
 
 void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
@@ -3511,10 +3870,9 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			break;
 		default:
-#if defined( MAME_DEBUG )
-			popmessage( "unknown GPU packet %08x", m_packet.n_entry[ 0 ] );
-#endif
-			verboselog( *this, 0, "unknown GPU packet %08x (%08x)\n", m_packet.n_entry[ 0 ], data );
+			m_gp0_report |= GP0_REPORT_UNKNOWN_PACKET;
+			m_gp0_unknown_packet = m_packet.n_entry[ 0 ];
+			m_gp0_unknown_data = data;
 #if ( STOP_ON_ERROR )
 			n_gpu_buffer_offset = 1;
 #endif
@@ -3530,9 +3888,10 @@ WRITE32_MEMBER( psxgpu_device::write )
 	switch( offset )
 	{
 	case 0x00:
-		gpu_write( &data, 1 );
+		gp0_write( &data, 1 );
 		break;
 	case 0x01:
+		gp0_sync();
 		switch( data >> 24 )
 		{
 		case 0x00:
@@ -3675,6 +4034,8 @@ void psxgpu_device::dma_read( UINT32 *p_n_psxram, UINT32 n_address, INT32 n_size
 
 void psxgpu_device::gpu_read( UINT32 *p_ram, INT32 n_size )
 {
+	gp0_sync();
+
 	while( n_size > 0 )
 	{
 		if( ( n_gpustatus & ( 1L << 0x1b ) ) != 0 )
@@ -3731,6 +4092,11 @@ READ32_MEMBER( psxgpu_device::read )
 		gpu_read( &data, 1 );
 		break;
 	case 0x01:
+		/* the status bits set by GP0 commands only change once the worker gets to them */
+		if( m_gp0_queue != nullptr )
+		{
+			gp0_kick( false );
+		}
 		data = n_gpustatus;
 		verboselog( *this, 1, "read GPU status (%08x)\n", data );
 		break;
@@ -3746,6 +4112,8 @@ void psxgpu_device::vblank(screen_device &screen, bool vblank_state)
 {
 	if( vblank_state )
 	{
+		gp0_sync();
+
 #if DEBUG_VIEWER
 		DebugCheckKeys();
 #endif
@@ -14,6 +14,8 @@
 
 #include "emu.h"
 
+#include <atomic>
+
 #define MCFG_PSX_GPU_VBLANK_HANDLER(_devcb) \
 	devcb = &psxgpu_device::set_vblank_handler(*device, DEVCB_##_devcb);
 
@@ -40,6 +42,9 @@
 #define MCFG_PSXGPU_VBLANK_CALLBACK( _delegate ) \
 	((screen_device *) config.device_find( device, "screen" ))->register_vblank_callback( _delegate );
 
+#define MCFG_PSXGPU_THREADED( _threaded ) \
+	psxgpu_device::set_threaded( *device, _threaded );
+
 extern const device_type CXD8514Q;
 extern const device_type CXD8538Q;
 extern const device_type CXD8561Q;
@@ -49,6 +54,10 @@ extern const device_type CXD8654Q;
 
 #define STOP_ON_ERROR ( 0 )
 
+/* GP0 words collected before they are handed to the worker, and the most that may wait behind it */
+#define GP0_BATCH_WORDS ( 1024 )
+#define GP0_FIFO_WORDS ( 0x10000 )
+
 #define MAX_LEVEL ( 32 )
 #define MID_LEVEL ( ( MAX_LEVEL / 2 ) << 8 )
 #define MAX_SHADE ( 0x100 )
@@ -194,6 +203,7 @@ public:
 
 	// static configuration helpers
 	template<class _Object> static devcb_base &set_vblank_handler(device_t &device, _Object object) { return downcast<psxgpu_device &>(device).m_vblank_handler.set_callback(object); }
+	static void set_threaded(device_t &device, bool threaded) { downcast<psxgpu_device &>(device).m_threaded = threaded; }
 
 	UINT32 update_screen(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect);
 	DECLARE_WRITE32_MEMBER( write );
@@ -208,6 +218,7 @@ public:
 protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_stop() override;
 
 private:
 	void updatevisiblearea();
@@ -231,6 +242,32 @@ private:
 	void gpu_reset();
 	void gpu_read( UINT32 *p_ram, INT32 n_size );
 	void gpu_write( UINT32 *p_ram, INT32 n_size );
+	void gp0_write( UINT32 *p_ram, INT32 n_size );
+	void gp0_kick( bool b_wait );
+	void gp0_sync();
+	void gp0_discard();
+	void gp0_report();
+	void gp0_presave();
+	void gp0_postload();
+	static void *gp0_callback( void *param, int threadid );
+
+	/* threaded mode: GP0 words are executed on a worker, in order, one batch at a time */
+	bool m_threaded;
+	osd_work_queue *m_gp0_queue;
+	osd_work_item *m_gp0_request;
+	std::vector<UINT32> m_gp0_fifo[ 2 ];
+	int m_gp0_fill;
+
+	/* what GP0 commands couldn't handle, logged by gp0_report() once they're done */
+	enum
+	{
+		GP0_REPORT_TP3 = 1,
+		GP0_REPORT_INTERLEAVED_15BIT = 2,
+		GP0_REPORT_UNKNOWN_PACKET = 4
+	};
+	UINT32 m_gp0_report;
+	UINT32 m_gp0_unknown_packet;
+	UINT32 m_gp0_unknown_data;
 
 	INT32 m_n_tx;
 	INT32 m_n_ty;
@@ -261,7 +298,8 @@ private:
 	UINT32 m_n_displaystartx;
 	UINT32 n_displaystarty;
 	int m_n_gputype;
-	UINT32 n_gpustatus;
+	std::atomic<UINT32> n_gpustatus;    /* the status read can race the GP0 worker; saved through n_gpustatus_state */
+	UINT32 n_gpustatus_state;
 	UINT32 n_gpuinfo;
 	UINT32 n_gpu_buffer_offset;
 	UINT32 n_lightgun_x;
@@ -17,16 +17,12 @@ Framebuffer todo:
 
 #include "emu.h"
 #include "includes/saturn.h"
+#include "video/stvvdp1fill.h"
 
 #define VDP1_LOG 0
 
-
-enum { FRAC_SHIFT = 16 };
-
-struct spoint {
-	INT32 x, y;
-	INT32 u, v;
-};
+/* lines per work item when rasterizing the draw list */
+#define STV_VDP1_BAND_LINES 32
 
 struct shaded_point
 {
@@ -509,22 +505,22 @@ the rest are data used by it
 
 */
 
-void saturn_state::stv_clear_gouraud_shading(void)
+void saturn_state::stv_clear_gouraud_shading(stv_vdp1_raster &rs)
 {
-	memset( &stv_gouraud_shading, 0, sizeof( stv_gouraud_shading ) );
+	memset( &rs.gouraud, 0, sizeof( rs.gouraud ) );
 }
 
-UINT8 saturn_state::stv_read_gouraud_table( void )
+UINT8 saturn_state::stv_read_gouraud_table(stv_vdp1_raster &rs)
 {
 	int gaddr;
 
-	if ( (stv2_current_sprite.CMDPMOD & 0x7) == 4 )
+	if ( (rs.sprite.CMDPMOD & 0x7) == 4 )
 	{
-		gaddr = stv2_current_sprite.CMDGRDA * 8;
-		stv_gouraud_shading.GA = (m_vdp1_vram[gaddr/4] >> 16) & 0xffff;
-		stv_gouraud_shading.GB = (m_vdp1_vram[gaddr/4] >> 0) & 0xffff;
-		stv_gouraud_shading.GC = (m_vdp1_vram[gaddr/4 + 1] >> 16) & 0xffff;
-		stv_gouraud_shading.GD = (m_vdp1_vram[gaddr/4 + 1] >> 0) & 0xffff;
+		gaddr = rs.sprite.CMDGRDA * 8;
+		rs.gouraud.GA = (m_vdp1_vram[gaddr/4] >> 16) & 0xffff;
+		rs.gouraud.GB = (m_vdp1_vram[gaddr/4] >> 0) & 0xffff;
+		rs.gouraud.GC = (m_vdp1_vram[gaddr/4 + 1] >> 16) & 0xffff;
+		rs.gouraud.GD = (m_vdp1_vram[gaddr/4 + 1] >> 0) & 0xffff;
 		return 1;
 	}
 	else
@@ -544,7 +540,7 @@ static inline INT32 _shading( INT32 color, INT32 correction )
 	return color;
 }
 
-UINT16 saturn_state::stv_vdp1_apply_gouraud_shading( int x, int y, UINT16 pix )
+UINT16 saturn_state::stv_vdp1_apply_gouraud_shading(stv_vdp1_raster &rs, int x, int y, UINT16 pix )
 {
 	INT32 r,g,b, msb;
 
@@ -574,7 +570,7 @@ UINT16 saturn_state::stv_vdp1_apply_gouraud_shading( int x, int y, UINT16 pix )
 	return msb | b << 10 | g << 5 | r;
 }
 
-void saturn_state::stv_vdp1_setup_shading_for_line(INT32 y, INT32 x1, INT32 x2,
+void saturn_state::stv_vdp1_setup_shading_for_line(stv_vdp1_raster &rs, INT32 y, INT32 x1, INT32 x2,
 											INT32 r1, INT32 g1, INT32 b1,
 											INT32 r2, INT32 g2, INT32 b2)
 {
@@ -590,7 +586,7 @@ void saturn_state::stv_vdp1_setup_shading_for_line(INT32 y, INT32 x1, INT32 x2,
 		SWAP_INT32(b1, b2);
 	}
 
-	if ( (y >= 0) && (y < 512) )
+	if ( (y >= rs.min_y) && (y <= rs.max_y) )
 	{
 		INT32  dx;
 		INT32   gbd, ggd, grd;
@@ -628,7 +624,7 @@ void saturn_state::stv_vdp1_setup_shading_for_line(INT32 y, INT32 x1, INT32 x2,
 	}
 }
 
-void saturn_state::stv_vdp1_setup_shading_for_slope(
+void saturn_state::stv_vdp1_setup_shading_for_slope(stv_vdp1_raster &rs,
 							INT32 x1, INT32 x2, INT32 sl1, INT32 sl2, INT32 *nx1, INT32 *nx2,
 							INT32 r1, INT32 r2, INT32 slr1, INT32 slr2, INT32 *nr1, INT32 *nr2,
 							INT32 g1, INT32 g2, INT32 slg1, INT32 slg2, INT32 *ng1, INT32 *ng2,
@@ -652,7 +648,7 @@ void saturn_state::stv_vdp1_setup_shading_for_slope(
 
 	while(_y1 < y2)
 	{
-		stv_vdp1_setup_shading_for_line(_y1, x1, x2, r1, g1, b1, r2, g2, b2);
+		stv_vdp1_setup_shading_for_line(rs, _y1, x1, x2, r1, g1, b1, r2, g2, b2);
 		x1 += sl1;
 		r1 += slr1;
 		g1 += slg1;
@@ -675,22 +671,23 @@ void saturn_state::stv_vdp1_setup_shading_for_slope(
 	*ng2 = g2;
 }
 
-void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangle &cliprect)
+void saturn_state::stv_vdp1_setup_shading(stv_vdp1_raster &rs, const struct spoint* q, const rectangle &cliprect)
 {
 	INT32 x1, x2, delta, cury, limy;
 	INT32 r1, g1, b1, r2, g2, b2;
 	INT32 sl1, slg1, slb1, slr1;
 	INT32 sl2, slg2, slb2, slr2;
+	INT32 sy, ey;
 	int pmin, pmax, i, ps1, ps2;
 	struct shaded_point p[8];
 	UINT16 gd[4];
 
-	if ( stv_read_gouraud_table() == 0 ) return;
+	if ( stv_read_gouraud_table(rs) == 0 ) return;
 
-	gd[0] = stv_gouraud_shading.GA;
-	gd[1] = stv_gouraud_shading.GB;
-	gd[2] = stv_gouraud_shading.GC;
-	gd[3] = stv_gouraud_shading.GD;
+	gd[0] = rs.gouraud.GA;
+	gd[1] = rs.gouraud.GB;
+	gd[2] = rs.gouraud.GC;
+	gd[3] = rs.gouraud.GD;
 
 	for(i=0; i<4; i++) {
 		p[i].x = p[i+4].x = q[i].x << FRAC_SHIFT;
@@ -711,8 +708,8 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 	cury = p[pmin].y;
 	limy = p[pmax].y;
 
-	stv_vdp1_shading_data->sy = cury;
-	stv_vdp1_shading_data->ey = limy;
+	sy = cury;
+	ey = limy;
 
 	if(cury == limy) {
 		x1 = x2 = p[0].x;
@@ -727,7 +724,7 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 				ps2 = i;
 			}
 		}
-		stv_vdp1_setup_shading_for_line(cury, x1, x2, p[ps1].r, p[ps1].g, p[ps1].b, p[ps2].r, p[ps2].g, p[ps2].b);
+		stv_vdp1_setup_shading_for_line(rs, cury, x1, x2, p[ps1].r, p[ps1].g, p[ps1].b, p[ps2].r, p[ps2].g, p[ps2].b);
 		goto finish;
 	}
 
@@ -738,7 +735,7 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 
 	for(;;) {
 		if(p[ps1-1].y == p[ps2+1].y) {
-			stv_vdp1_setup_shading_for_slope(
+			stv_vdp1_setup_shading_for_slope(rs,
 							x1, x2, sl1, sl2, &x1, &x2,
 							r1, r2, slr1, slr2, &r1, &r2,
 							g1, g2, slg1, slg2, &g1, &g2,
@@ -776,7 +773,7 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 			slg2 = (g2-p[ps2+1].g)/delta;
 			slb2 = (b2-p[ps2+1].b)/delta;
 		} else if(p[ps1-1].y < p[ps2+1].y) {
-			stv_vdp1_setup_shading_for_slope(
+			stv_vdp1_setup_shading_for_slope(rs,
 							x1, x2, sl1, sl2, &x1, &x2,
 							r1, r2, slr1, slr2, &r1, &r2,
 							g1, g2, slg1, slg2, &g1, &g2,
@@ -799,7 +796,7 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 			slg1 = (g1-p[ps1-1].g)/delta;
 			slb1 = (b1-p[ps1-1].b)/delta;
 		} else {
-			stv_vdp1_setup_shading_for_slope(
+			stv_vdp1_setup_shading_for_slope(rs,
 							x1, x2, sl1, sl2, &x1, &x2,
 							r1, r2, slr1, slr2, &r1, &r2,
 							g1, g2, slg1, slg2, &g1, &g2,
@@ -824,16 +821,16 @@ void saturn_state::stv_vdp1_setup_shading(const struct spoint* q, const rectangl
 		}
 	}
 	if(cury == limy)
-		stv_vdp1_setup_shading_for_line(cury, x1, x2, r1, g1, b1, r2, g2, b2 );
+		stv_vdp1_setup_shading_for_line(rs, cury, x1, x2, r1, g1, b1, r2, g2, b2 );
 
 finish:
 
-	if ( stv_vdp1_shading_data->sy < 0 ) stv_vdp1_shading_data->sy = 0;
-	if ( stv_vdp1_shading_data->sy >= 512 ) return;
-	if ( stv_vdp1_shading_data->ey < 0 ) return;
-	if ( stv_vdp1_shading_data->ey >= 512 ) stv_vdp1_shading_data->ey = 511;
+	if ( sy < rs.min_y ) sy = rs.min_y;
+	if ( sy > rs.max_y ) return;
+	if ( ey < rs.min_y ) return;
+	if ( ey > rs.max_y ) ey = rs.max_y;
 
-	for ( cury = stv_vdp1_shading_data->sy; cury <= stv_vdp1_shading_data->ey; cury++ )
+	for ( cury = sy; cury <= ey; cury++ )
 	{
 		while( (stv_vdp1_shading_data->scanline[cury].x[0] >> 16) < cliprect.min_x )
 		{
@@ -853,49 +850,49 @@ why they would want to */
 
 
 
-void saturn_state::drawpixel_poly(int x, int y, int patterndata, int offsetcnt)
+void saturn_state::drawpixel_poly(stv_vdp1_raster &rs, int x, int y, int patterndata, int offsetcnt)
 {
 	/* Capcom Collection Dai 4 uses a dummy polygon to clear VDP1 framebuffer that goes over our current max size ... */
 	if(x >= 1024 || y >= 512)
 		return;
 
-	m_vdp1.framebuffer_draw_lines[y][x] = stv2_current_sprite.CMDCOLR;
+	m_vdp1.framebuffer_draw_lines[y][x] = rs.sprite.CMDCOLR;
 }
 
-void saturn_state::drawpixel_8bpp_trans(int x, int y, int patterndata, int offsetcnt)
+void saturn_state::drawpixel_8bpp_trans(stv_vdp1_raster &rs, int x, int y, int patterndata, int offsetcnt)
 {
 	UINT16 pix;
 
 	pix = m_vdp1.gfx_decode[patterndata+offsetcnt];
 	if ( pix & 0xff )
 	{
-		m_vdp1.framebuffer_draw_lines[y][x] = pix | m_sprite_colorbank;
+		m_vdp1.framebuffer_draw_lines[y][x] = pix | rs.sprite_colorbank;
 	}
 }
 
-void saturn_state::drawpixel_4bpp_notrans(int x, int y, int patterndata, int offsetcnt)
+void saturn_state::drawpixel_4bpp_notrans(stv_vdp1_raster &rs, int x, int y, int patterndata, int offsetcnt)
 {
 	UINT16 pix;
 
 	pix = m_vdp1.gfx_decode[patterndata+offsetcnt/2];
 	pix = offsetcnt&1 ? (pix & 0x0f) : ((pix & 0xf0)>>4);
-	m_vdp1.framebuffer_draw_lines[y][x] = pix | m_sprite_colorbank;
+	m_vdp1.framebuffer_draw_lines[y][x] = pix | rs.sprite_colorbank;
 }
 
-void saturn_state::drawpixel_4bpp_trans(int x, int y, int patterndata, int offsetcnt)
+void saturn_state::drawpixel_4bpp_trans(stv_vdp1_raster &rs, int x, int y, int patterndata, int offsetcnt)
 {
 	UINT16 pix;
 
 	pix = m_vdp1.gfx_decode[patterndata+offsetcnt/2];
 	pix = offsetcnt&1 ? (pix & 0x0f) : ((pix & 0xf0)>>4);
 	if ( pix )
-		m_vdp1.framebuffer_draw_lines[y][x] = pix | m_sprite_colorbank;
+		m_vdp1.framebuffer_draw_lines[y][x] = pix | rs.sprite_colorbank;
 }
 
-void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcnt)
+void saturn_state::drawpixel_generic(stv_vdp1_raster &rs, int x, int y, int patterndata, int offsetcnt)
 {
-	int pix,mode,transmask, spd = stv2_current_sprite.CMDPMOD & 0x40;
-	int mesh = stv2_current_sprite.CMDPMOD & 0x100;
+	int pix,mode,transmask, spd = rs.sprite.CMDPMOD & 0x40;
+	int mesh = rs.sprite.CMDPMOD & 0x100;
 	int pix2;
 
 	if ( mesh && !((x ^ y) & 1) )
@@ -903,9 +900,9 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 		return;
 	}
 
-	if ( stv2_current_sprite.ispoly )
+	if ( rs.sprite.ispoly )
 	{
-		pix = stv2_current_sprite.CMDCOLR&0xffff;
+		pix = rs.sprite.CMDCOLR&0xffff;
 
 		transmask = 0xffff;
 		if ( pix & 0x8000 )
@@ -919,13 +916,13 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 	}
 	else
 	{
-		switch (stv2_current_sprite.CMDPMOD&0x0038)
+		switch (rs.sprite.CMDPMOD&0x0038)
 		{
 			case 0x0000: // mode 0 16 colour bank mode (4bits) (hanagumi blocks)
 				// most of the shienryu sprites use this mode
 				pix = m_vdp1.gfx_decode[(patterndata+offsetcnt/2) & 0xfffff];
 				pix = offsetcnt&1 ? (pix & 0x0f) : ((pix & 0xf0)>>4);
-				pix = pix+((stv2_current_sprite.CMDCOLR&0xfff0));
+				pix = pix+((rs.sprite.CMDCOLR&0xfff0));
 				mode = 0;
 				transmask = 0xf;
 				break;
@@ -934,8 +931,8 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 				pix2 = m_vdp1.gfx_decode[(patterndata+offsetcnt/2) & 0xfffff];
 				pix2 = offsetcnt&1 ? (pix2 & 0x0f) : ((pix2 & 0xf0)>>4);
 				pix = pix2&1 ?
-				((((m_vdp1_vram[(((stv2_current_sprite.CMDCOLR&0xffff)*8)>>2)+((pix2&0xfffe)/2)])) & 0x0000ffff) >> 0):
-				((((m_vdp1_vram[(((stv2_current_sprite.CMDCOLR&0xffff)*8)>>2)+((pix2&0xfffe)/2)])) & 0xffff0000) >> 16);
+				((((m_vdp1_vram[(((rs.sprite.CMDCOLR&0xffff)*8)>>2)+((pix2&0xfffe)/2)])) & 0x0000ffff) >> 0):
+				((((m_vdp1_vram[(((rs.sprite.CMDCOLR&0xffff)*8)>>2)+((pix2&0xfffe)/2)])) & 0xffff0000) >> 16);
 
 				mode = 5;
 				transmask = 0xffff;
@@ -955,18 +952,18 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 			case 0x0010: // mode 2 64 colour bank mode (8bits) (character select portraits on hanagumi)
 				pix = m_vdp1.gfx_decode[(patterndata+offsetcnt) & 0xfffff];
 				mode = 2;
-				pix = pix+(stv2_current_sprite.CMDCOLR&0xffc0);
+				pix = pix+(rs.sprite.CMDCOLR&0xffc0);
 				transmask = 0x3f;
 				break;
 			case 0x0018: // mode 3 128 colour bank mode (8bits) (little characters on hanagumi use this mode)
 				pix = m_vdp1.gfx_decode[(patterndata+offsetcnt) & 0xfffff];
-				pix = pix+(stv2_current_sprite.CMDCOLR&0xff80);
+				pix = pix+(rs.sprite.CMDCOLR&0xff80);
 				transmask = 0x7f;
 				mode = 3;
 				break;
 			case 0x0020: // mode 4 256 colour bank mode (8bits) (hanagumi title)
 				pix = m_vdp1.gfx_decode[(patterndata+offsetcnt) & 0xfffff];
-				pix = pix+(stv2_current_sprite.CMDCOLR&0xff00);
+				pix = pix+(rs.sprite.CMDCOLR&0xff00);
 				transmask = 0xff;
 				mode = 4;
 				break;
@@ -984,7 +981,7 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 
 
 		// preliminary end code disable support
-		if ( ((stv2_current_sprite.CMDPMOD & 0x80) == 0) &&
+		if ( ((rs.sprite.CMDPMOD & 0x80) == 0) &&
 			((pix & transmask) == transmask) )
 		{
 			return;
@@ -992,7 +989,7 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 	}
 
 	/* MSBON */
-	pix |= stv2_current_sprite.CMDPMOD & 0x8000;
+	pix |= rs.sprite.CMDPMOD & 0x8000;
 	if ( mode != 5 )
 	{
 		if ( (pix & transmask) || spd )
@@ -1004,7 +1001,7 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 	{
 		if ( (pix & transmask) || spd )
 		{
-			switch( stv2_current_sprite.CMDPMOD & 0x7 )
+			switch( rs.sprite.CMDPMOD & 0x7 )
 			{
 				case 0: /* replace */
 					m_vdp1.framebuffer_draw_lines[y][x] = pix;
@@ -1029,7 +1026,7 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 					}
 					break;
 				case 4: /* Gouraud shading */
-					m_vdp1.framebuffer_draw_lines[y][x] = stv_vdp1_apply_gouraud_shading( x, y, pix );
+					m_vdp1.framebuffer_draw_lines[y][x] = stv_vdp1_apply_gouraud_shading(rs, x, y, pix);
 					break;
 				default:
 					m_vdp1.framebuffer_draw_lines[y][x] = pix;
@@ -1040,426 +1037,146 @@ void saturn_state::drawpixel_generic(int x, int y, int patterndata, int offsetcn
 }
 
 
-void saturn_state::stv_vdp1_set_drawpixel( void )
+void saturn_state::stv_vdp1_set_drawpixel(stv_vdp1_raster &rs)
 {
-	int sprite_type = stv2_current_sprite.CMDCTRL & 0x000f;
-	int sprite_mode = stv2_current_sprite.CMDPMOD&0x0038;
-	int spd = stv2_current_sprite.CMDPMOD & 0x40;
-	int mesh = stv2_current_sprite.CMDPMOD & 0x100;
-	int ecd = stv2_current_sprite.CMDPMOD & 0x80;
+	int sprite_type = rs.sprite.CMDCTRL & 0x000f;
+	int sprite_mode = rs.sprite.CMDPMOD&0x0038;
+	int spd = rs.sprite.CMDPMOD & 0x40;
+	int mesh = rs.sprite.CMDPMOD & 0x100;
+	int ecd = rs.sprite.CMDPMOD & 0x80;
 
-	if ( mesh || !ecd || ((stv2_current_sprite.CMDPMOD & 0x7) != 0) )
+	if ( mesh || !ecd || ((rs.sprite.CMDPMOD & 0x7) != 0) )
 	{
-		drawpixel = &saturn_state::drawpixel_generic;
+		rs.drawpixel = &saturn_state::drawpixel_generic;
 		return;
 	}
 
-	if (sprite_type == 4 && ((stv2_current_sprite.CMDPMOD & 0x7) == 0))
+	if (sprite_type == 4 && ((rs.sprite.CMDPMOD & 0x7) == 0))
 	{
-		drawpixel = &saturn_state::drawpixel_poly;
+		rs.drawpixel = &saturn_state::drawpixel_poly;
 	}
 	else if ( (sprite_mode == 0x20) && !spd )
 	{
-		m_sprite_colorbank = (stv2_current_sprite.CMDCOLR&0xff00);
-		drawpixel = &saturn_state::drawpixel_8bpp_trans;
+		rs.sprite_colorbank = (rs.sprite.CMDCOLR&0xff00);
+		rs.drawpixel = &saturn_state::drawpixel_8bpp_trans;
 	}
 	else if ((sprite_mode == 0x00) && spd)
 	{
-		m_sprite_colorbank = (stv2_current_sprite.CMDCOLR&0xfff0);
-		drawpixel = &saturn_state::drawpixel_4bpp_notrans;
+		rs.sprite_colorbank = (rs.sprite.CMDCOLR&0xfff0);
+		rs.drawpixel = &saturn_state::drawpixel_4bpp_notrans;
 	}
 	else if (sprite_mode == 0x00 && !spd )
 	{
-		m_sprite_colorbank = (stv2_current_sprite.CMDCOLR&0xfff0);
-		drawpixel = &saturn_state::drawpixel_4bpp_trans;
+		rs.sprite_colorbank = (rs.sprite.CMDCOLR&0xfff0);
+		rs.drawpixel = &saturn_state::drawpixel_4bpp_trans;
 	}
 	else
 	{
-		drawpixel = &saturn_state::drawpixel_generic;
+		rs.drawpixel = &saturn_state::drawpixel_generic;
 	}
 }
 
 
-void saturn_state::vdp1_fill_slope(const rectangle &cliprect, int patterndata, int xsize,
-							INT32 x1, INT32 x2, INT32 sl1, INT32 sl2, INT32 *nx1, INT32 *nx2,
-							INT32 u1, INT32 u2, INT32 slu1, INT32 slu2, INT32 *nu1, INT32 *nu2,
-							INT32 v1, INT32 v2, INT32 slv1, INT32 slv2, INT32 *nv1, INT32 *nv2,
-							INT32 _y1, INT32 y2)
+void saturn_state::vdp1_fill_quad(stv_vdp1_raster &rs, const rectangle &cliprect, int patterndata, int xsize, const struct spoint *q)
 {
-	if(_y1 > cliprect.max_y)
-		return;
-
-	if(y2 <= cliprect.min_y) {
-		int delta = y2-_y1;
-		*nx1 = x1+delta*sl1;
-		*nu1 = u1+delta*slu1;
-		*nv1 = v1+delta*slv1;
-		*nx2 = x2+delta*sl2;
-		*nu2 = u2+delta*slu2;
-		*nv2 = v2+delta*slv2;
-		return;
-	}
-
-	if(y2 > cliprect.max_y)
-		y2 = cliprect.max_y+1;
-
-	if(_y1 < cliprect.min_y) {
-		int delta = cliprect.min_y - _y1;
-		x1 += delta*sl1;
-		u1 += delta*slu1;
-		v1 += delta*slv1;
-		x2 += delta*sl2;
-		u2 += delta*slu2;
-		v2 += delta*slv2;
-		_y1 = cliprect.min_y;
-	}
-
-	if(x1 > x2 || (x1==x2 && sl1 > sl2)) {
-		INT32 t, *tp;
-		t = x1;
-		x1 = x2;
-		x2 = t;
-		t = sl1;
-		sl1 = sl2;
-		sl2 = t;
-		tp = nx1;
-		nx1 = nx2;
-		nx2 = tp;
-
-		t = u1;
-		u1 = u2;
-		u2 = t;
-		t = slu1;
-		slu1 = slu2;
-		slu2 = t;
-		tp = nu1;
-		nu1 = nu2;
-		nu2 = tp;
-
-		t = v1;
-		v1 = v2;
-		v2 = t;
-		t = slv1;
-		slv1 = slv2;
-		slv2 = t;
-		tp = nv1;
-		nv1 = nv2;
-		nv2 = tp;
-	}
-
-	while(_y1 < y2) {
-		if(_y1 >= cliprect.min_y) {
-			INT32 slux = 0, slvx = 0;
-			int xx1 = x1>>FRAC_SHIFT;
-			int xx2 = x2>>FRAC_SHIFT;
-			INT32 u = u1;
-			INT32 v = v1;
-			if(xx1 != xx2) {
-				int delta = xx2-xx1;
-				slux = (u2-u1)/delta;
-				slvx = (v2-v1)/delta;
-			}
-			if(xx1 <= cliprect.max_x || xx2 >= cliprect.min_x) {
-				if(xx1 < cliprect.min_x) {
-					int delta = cliprect.min_x-xx1;
-					u += slux*delta;
-					v += slvx*delta;
-					xx1 = cliprect.min_x;
-				}
-				if(xx2 > cliprect.max_x)
-					xx2 = cliprect.max_x;
-
-				while(xx1 <= xx2) {
-					(this->*drawpixel)(xx1,_y1, patterndata, (v>>FRAC_SHIFT)*xsize+(u>>FRAC_SHIFT));
-					xx1++;
-					u += slux;
-					v += slvx;
-				}
-			}
-		}
-
-		x1 += sl1;
-		u1 += slu1;
-		v1 += slv1;
-		x2 += sl2;
-		u2 += slu2;
-		v2 += slv2;
-		_y1++;
-	}
-	*nx1 = x1;
-	*nu1 = u1;
-	*nv1 = v1;
-	*nx2 = x2;
-	*nu2 = u2;
-	*nv2 = v2;
+	::vdp1_fill_quad(cliprect, patterndata, xsize, q, [this, &rs](int x, int y, int pattern, int offsetcnt) {
+		(this->*rs.drawpixel)(rs, x, y, pattern, offsetcnt);
+	});
 }
 
-void saturn_state::vdp1_fill_line(const rectangle &cliprect, int patterndata, int xsize, INT32 y,
-							INT32 x1, INT32 x2, INT32 u1, INT32 u2, INT32 v1, INT32 v2)
+int saturn_state::x2s(const stv_vdp1_raster &rs, int v)
 {
-	int xx1 = x1>>FRAC_SHIFT;
-	int xx2 = x2>>FRAC_SHIFT;
-
-	if(y > cliprect.max_y || y < cliprect.min_y)
-		return;
-
-	if(xx1 <= cliprect.max_x || xx2 >= cliprect.min_x) {
-		INT32 slux = 0, slvx = 0;
-		INT32 u = u1;
-		INT32 v = v1;
-		if(xx1 != xx2) {
-			int delta = xx2-xx1;
-			slux = (u2-u1)/delta;
-			slvx = (v2-v1)/delta;
-		}
-		if(xx1 < cliprect.min_x) {
-			int delta = cliprect.min_x-xx1;
-			u += slux*delta;
-			v += slvx*delta;
-			xx1 = cliprect.min_x;
-		}
-		if(xx2 > cliprect.max_x)
-			xx2 = cliprect.max_x;
-
-		while(xx1 <= xx2) {
-			(this->*drawpixel)(xx1,y,patterndata,(v>>FRAC_SHIFT)*xsize+(u>>FRAC_SHIFT));
-			xx1++;
-			u += slux;
-			v += slvx;
-		}
-	}
+	return (INT32)(INT16)v + rs.local_x;
 }
 
-void saturn_state::vdp1_fill_quad(const rectangle &cliprect, int patterndata, int xsize, const struct spoint *q)
+int saturn_state::y2s(const stv_vdp1_raster &rs, int v)
 {
-	INT32 sl1, sl2, slu1, slu2, slv1, slv2, cury, limy, x1, x2, u1, u2, v1, v2, delta;
-	int pmin, pmax, i, ps1, ps2;
-	struct spoint p[8];
-
-	for(i=0; i<4; i++) {
-		p[i].x = p[i+4].x = q[i].x << FRAC_SHIFT;
-		p[i].y = p[i+4].y = q[i].y;
-		p[i].u = p[i+4].u = q[i].u << FRAC_SHIFT;
-		p[i].v = p[i+4].v = q[i].v << FRAC_SHIFT;
-	}
-
-	pmin = pmax = 0;
-	for(i=1; i<4; i++) {
-		if(p[i].y < p[pmin].y)
-			pmin = i;
-		if(p[i].y > p[pmax].y)
-			pmax = i;
-	}
-
-	cury = p[pmin].y;
-	limy = p[pmax].y;
-
-	if(cury == limy) {
-		x1 = x2 = p[0].x;
-		u1 = u2 = p[0].u;
-		v1 = v2 = p[0].v;
-		for(i=1; i<4; i++) {
-			if(p[i].x < x1) {
-				x1 = p[i].x;
-				u1 = p[i].u;
-				v1 = p[i].v;
-			}
-			if(p[i].x > x2) {
-				x2 = p[i].x;
-				u2 = p[i].u;
-				v2 = p[i].v;
-			}
-		}
-		vdp1_fill_line(cliprect, patterndata, xsize, cury, x1, x2, u1, u2, v1, v2);
-		return;
-	}
-
-	if(cury > cliprect.max_y)
-		return;
-	if(limy <= cliprect.min_y)
-		return;
-
-	if(limy > cliprect.max_y)
-		limy = cliprect.max_y;
-
-	ps1 = pmin+4;
-	ps2 = pmin;
-
-	goto startup;
-
-	for(;;) {
-		if(p[ps1-1].y == p[ps2+1].y) {
-			vdp1_fill_slope(cliprect, patterndata, xsize,
-							x1, x2, sl1, sl2, &x1, &x2,
-							u1, u2, slu1, slu2, &u1, &u2,
-							v1, v2, slv1, slv2, &v1, &v2,
-							cury, p[ps1-1].y);
-			cury = p[ps1-1].y;
-			if(cury >= limy)
-				break;
-			ps1--;
-			ps2++;
-
-		startup:
-			while(p[ps1-1].y == cury)
-				ps1--;
-			while(p[ps2+1].y == cury)
-				ps2++;
-			x1 = p[ps1].x;
-			u1 = p[ps1].u;
-			v1 = p[ps1].v;
-			x2 = p[ps2].x;
-			u2 = p[ps2].u;
-			v2 = p[ps2].v;
-
-			delta = cury-p[ps1-1].y;
-			sl1 = (x1-p[ps1-1].x)/delta;
-			slu1 = (u1-p[ps1-1].u)/delta;
-			slv1 = (v1-p[ps1-1].v)/delta;
-
-			delta = cury-p[ps2+1].y;
-			sl2 = (x2-p[ps2+1].x)/delta;
-			slu2 = (u2-p[ps2+1].u)/delta;
-			slv2 = (v2-p[ps2+1].v)/delta;
-		} else if(p[ps1-1].y < p[ps2+1].y) {
-			vdp1_fill_slope(cliprect, patterndata, xsize,
-							x1, x2, sl1, sl2, &x1, &x2,
-							u1, u2, slu1, slu2, &u1, &u2,
-							v1, v2, slv1, slv2, &v1, &v2,
-							cury, p[ps1-1].y);
-			cury = p[ps1-1].y;
-			if(cury >= limy)
-				break;
-			ps1--;
-			while(p[ps1-1].y == cury)
-				ps1--;
-			x1 = p[ps1].x;
-			u1 = p[ps1].u;
-			v1 = p[ps1].v;
-
-			delta = cury-p[ps1-1].y;
-			sl1 = (x1-p[ps1-1].x)/delta;
-			slu1 = (u1-p[ps1-1].u)/delta;
-			slv1 = (v1-p[ps1-1].v)/delta;
-		} else {
-			vdp1_fill_slope(cliprect, patterndata, xsize,
-							x1, x2, sl1, sl2, &x1, &x2,
-							u1, u2, slu1, slu2, &u1, &u2,
-							v1, v2, slv1, slv2, &v1, &v2,
-							cury, p[ps2+1].y);
-			cury = p[ps2+1].y;
-			if(cury >= limy)
-				break;
-			ps2++;
-			while(p[ps2+1].y == cury)
-				ps2++;
-			x2 = p[ps2].x;
-			u2 = p[ps2].u;
-			v2 = p[ps2].v;
-
-			delta = cury-p[ps2+1].y;
-			sl2 = (x2-p[ps2+1].x)/delta;
-			slu2 = (u2-p[ps2+1].u)/delta;
-			slv2 = (v2-p[ps2+1].v)/delta;
-		}
-	}
-	if(cury == limy)
-		vdp1_fill_line(cliprect, patterndata, xsize, cury, x1, x2, u1, u2, v1, v2);
-}
-
-int saturn_state::x2s(int v)
-{
-	return (INT32)(INT16)v + m_vdp1.local_x;
+	return (INT32)(INT16)v + rs.local_y;
 }
 
-int saturn_state::y2s(int v)
-{
-	return (INT32)(INT16)v + m_vdp1.local_y;
-}
-
-void saturn_state::stv_vdp1_draw_line(const rectangle &cliprect)
+void saturn_state::stv_vdp1_draw_line(stv_vdp1_raster &rs, const rectangle &cliprect)
 {
 	struct spoint q[4];
 
-	q[0].x = x2s(stv2_current_sprite.CMDXA);
-	q[0].y = y2s(stv2_current_sprite.CMDYA);
-	q[1].x = x2s(stv2_current_sprite.CMDXB);
-	q[1].y = y2s(stv2_current_sprite.CMDYB);
-	q[2].x = x2s(stv2_current_sprite.CMDXA);
-	q[2].y = y2s(stv2_current_sprite.CMDYA);
-	q[3].x = x2s(stv2_current_sprite.CMDXB);
-	q[3].y = y2s(stv2_current_sprite.CMDYB);
+	q[0].x = x2s(rs, rs.sprite.CMDXA);
+	q[0].y = y2s(rs, rs.sprite.CMDYA);
+	q[1].x = x2s(rs, rs.sprite.CMDXB);
+	q[1].y = y2s(rs, rs.sprite.CMDYB);
+	q[2].x = x2s(rs, rs.sprite.CMDXA);
+	q[2].y = y2s(rs, rs.sprite.CMDYA);
+	q[3].x = x2s(rs, rs.sprite.CMDXB);
+	q[3].y = y2s(rs, rs.sprite.CMDYB);
 
 	q[0].u = q[3].u = q[1].u = q[2].u = 0;
 	q[0].v = q[1].v = q[2].v = q[3].v = 0;
 
-	vdp1_fill_quad(cliprect, 0, 1, q);
+	vdp1_fill_quad(rs, cliprect, 0, 1, q);
 }
 
-void saturn_state::stv_vdp1_draw_poly_line(const rectangle &cliprect)
+void saturn_state::stv_vdp1_draw_poly_line(stv_vdp1_raster &rs, const rectangle &cliprect)
 {
 	struct spoint q[4];
 
-	q[0].x = x2s(stv2_current_sprite.CMDXA);
-	q[0].y = y2s(stv2_current_sprite.CMDYA);
-	q[1].x = x2s(stv2_current_sprite.CMDXB);
-	q[1].y = y2s(stv2_current_sprite.CMDYB);
-	q[2].x = x2s(stv2_current_sprite.CMDXA);
-	q[2].y = y2s(stv2_current_sprite.CMDYA);
-	q[3].x = x2s(stv2_current_sprite.CMDXB);
-	q[3].y = y2s(stv2_current_sprite.CMDYB);
+	q[0].x = x2s(rs, rs.sprite.CMDXA);
+	q[0].y = y2s(rs, rs.sprite.CMDYA);
+	q[1].x = x2s(rs, rs.sprite.CMDXB);
+	q[1].y = y2s(rs, rs.sprite.CMDYB);
+	q[2].x = x2s(rs, rs.sprite.CMDXA);
+	q[2].y = y2s(rs, rs.sprite.CMDYA);
+	q[3].x = x2s(rs, rs.sprite.CMDXB);
+	q[3].y = y2s(rs, rs.sprite.CMDYB);
 
 	q[0].u = q[3].u = q[1].u = q[2].u = 0;
 	q[0].v = q[1].v = q[2].v = q[3].v = 0;
 
-	vdp1_fill_quad(cliprect, 0, 1, q);
+	vdp1_fill_quad(rs, cliprect, 0, 1, q);
 
-	q[0].x = x2s(stv2_current_sprite.CMDXB);
-	q[0].y = y2s(stv2_current_sprite.CMDYB);
-	q[1].x = x2s(stv2_current_sprite.CMDXC);
-	q[1].y = y2s(stv2_current_sprite.CMDYC);
-	q[2].x = x2s(stv2_current_sprite.CMDXB);
-	q[2].y = y2s(stv2_current_sprite.CMDYB);
-	q[3].x = x2s(stv2_current_sprite.CMDXC);
-	q[3].y = y2s(stv2_current_sprite.CMDYC);
+	q[0].x = x2s(rs, rs.sprite.CMDXB);
+	q[0].y = y2s(rs, rs.sprite.CMDYB);
+	q[1].x = x2s(rs, rs.sprite.CMDXC);
+	q[1].y = y2s(rs, rs.sprite.CMDYC);
+	q[2].x = x2s(rs, rs.sprite.CMDXB);
+	q[2].y = y2s(rs, rs.sprite.CMDYB);
+	q[3].x = x2s(rs, rs.sprite.CMDXC);
+	q[3].y = y2s(rs, rs.sprite.CMDYC);
 
 	q[0].u = q[3].u = q[1].u = q[2].u = 0;
 	q[0].v = q[1].v = q[2].v = q[3].v = 0;
 
-	vdp1_fill_quad(cliprect, 0, 1, q);
+	vdp1_fill_quad(rs, cliprect, 0, 1, q);
 
-	q[0].x = x2s(stv2_current_sprite.CMDXC);
-	q[0].y = y2s(stv2_current_sprite.CMDYC);
-	q[1].x = x2s(stv2_current_sprite.CMDXD);
-	q[1].y = y2s(stv2_current_sprite.CMDYD);
-	q[2].x = x2s(stv2_current_sprite.CMDXC);
-	q[2].y = y2s(stv2_current_sprite.CMDYC);
-	q[3].x = x2s(stv2_current_sprite.CMDXD);
-	q[3].y = y2s(stv2_current_sprite.CMDYD);
+	q[0].x = x2s(rs, rs.sprite.CMDXC);
+	q[0].y = y2s(rs, rs.sprite.CMDYC);
+	q[1].x = x2s(rs, rs.sprite.CMDXD);
+	q[1].y = y2s(rs, rs.sprite.CMDYD);
+	q[2].x = x2s(rs, rs.sprite.CMDXC);
+	q[2].y = y2s(rs, rs.sprite.CMDYC);
+	q[3].x = x2s(rs, rs.sprite.CMDXD);
+	q[3].y = y2s(rs, rs.sprite.CMDYD);
 
 	q[0].u = q[3].u = q[1].u = q[2].u = 0;
 	q[0].v = q[1].v = q[2].v = q[3].v = 0;
 
-	vdp1_fill_quad(cliprect, 0, 1, q);
+	vdp1_fill_quad(rs, cliprect, 0, 1, q);
 
-	q[0].x = x2s(stv2_current_sprite.CMDXD);
-	q[0].y = y2s(stv2_current_sprite.CMDYD);
-	q[1].x = x2s(stv2_current_sprite.CMDXA);
-	q[1].y = y2s(stv2_current_sprite.CMDYA);
-	q[2].x = x2s(stv2_current_sprite.CMDXD);
-	q[2].y = y2s(stv2_current_sprite.CMDYD);
-	q[3].x = x2s(stv2_current_sprite.CMDXA);
-	q[3].y = y2s(stv2_current_sprite.CMDYA);
+	q[0].x = x2s(rs, rs.sprite.CMDXD);
+	q[0].y = y2s(rs, rs.sprite.CMDYD);
+	q[1].x = x2s(rs, rs.sprite.CMDXA);
+	q[1].y = y2s(rs, rs.sprite.CMDYA);
+	q[2].x = x2s(rs, rs.sprite.CMDXD);
+	q[2].y = y2s(rs, rs.sprite.CMDYD);
+	q[3].x = x2s(rs, rs.sprite.CMDXA);
+	q[3].y = y2s(rs, rs.sprite.CMDYA);
 
 	q[0].u = q[3].u = q[1].u = q[2].u = 0;
 	q[0].v = q[1].v = q[2].v = q[3].v = 0;
 
-	stv_vdp1_setup_shading(q, cliprect);
-	vdp1_fill_quad(cliprect, 0, 1, q);
+	stv_vdp1_setup_shading(rs, q, cliprect);
+	vdp1_fill_quad(rs, cliprect, 0, 1, q);
 
 }
 
-void saturn_state::stv_vdp1_draw_distorted_sprite(const rectangle &cliprect)
+void saturn_state::stv_vdp1_draw_distorted_sprite(stv_vdp1_raster &rs, const rectangle &cliprect)
 {
 	struct spoint q[4];
 
@@ -1467,36 +1184,36 @@ void saturn_state::stv_vdp1_draw_distorted_sprite(const rectangle &cliprect)
 	int direction;
 	int patterndata;
 
-	direction = (stv2_current_sprite.CMDCTRL & 0x0030)>>4;
+	direction = (rs.sprite.CMDCTRL & 0x0030)>>4;
 
-	if ( stv2_current_sprite.ispoly )
+	if ( rs.sprite.ispoly )
 	{
 		xsize = ysize = 1;
 		patterndata = 0;
 	}
 	else
 	{
-		xsize = (stv2_current_sprite.CMDSIZE & 0x3f00) >> 8;
+		xsize = (rs.sprite.CMDSIZE & 0x3f00) >> 8;
 		xsize = xsize * 8;
 		if (xsize == 0) return; /* setting prohibited */
 
-		ysize = (stv2_current_sprite.CMDSIZE & 0x00ff);
+		ysize = (rs.sprite.CMDSIZE & 0x00ff);
 		if (ysize == 0) return; /* setting prohibited */
 
-		patterndata = (stv2_current_sprite.CMDSRCA) & 0xffff;
+		patterndata = (rs.sprite.CMDSRCA) & 0xffff;
 		patterndata = patterndata * 0x8;
 
 	}
 
 
-	q[0].x = x2s(stv2_current_sprite.CMDXA);
-	q[0].y = y2s(stv2_current_sprite.CMDYA);
-	q[1].x = x2s(stv2_current_sprite.CMDXB);
-	q[1].y = y2s(stv2_current_sprite.CMDYB);
-	q[2].x = x2s(stv2_current_sprite.CMDXC);
-	q[2].y = y2s(stv2_current_sprite.CMDYC);
-	q[3].x = x2s(stv2_current_sprite.CMDXD);
-	q[3].y = y2s(stv2_current_sprite.CMDYD);
+	q[0].x = x2s(rs, rs.sprite.CMDXA);
+	q[0].y = y2s(rs, rs.sprite.CMDYA);
+	q[1].x = x2s(rs, rs.sprite.CMDXB);
+	q[1].y = y2s(rs, rs.sprite.CMDYB);
+	q[2].x = x2s(rs, rs.sprite.CMDXC);
+	q[2].y = y2s(rs, rs.sprite.CMDYC);
+	q[3].x = x2s(rs, rs.sprite.CMDXD);
+	q[3].y = y2s(rs, rs.sprite.CMDYD);
 
 	if(direction & 1) { // xflip
 		q[0].u = q[3].u = xsize-1;
@@ -1513,11 +1230,11 @@ void saturn_state::stv_vdp1_draw_distorted_sprite(const rectangle &cliprect)
 		q[2].v = q[3].v = ysize-1;
 	}
 
-	stv_vdp1_setup_shading(q, cliprect);
-	vdp1_fill_quad(cliprect, patterndata, xsize, q);
+	stv_vdp1_setup_shading(rs, q, cliprect);
+	vdp1_fill_quad(rs, cliprect, patterndata, xsize, q);
 }
 
-void saturn_state::stv_vdp1_draw_scaled_sprite(const rectangle &cliprect)
+void saturn_state::stv_vdp1_draw_scaled_sprite(stv_vdp1_raster &rs, const rectangle &cliprect)
 {
 	struct spoint q[4];
 
@@ -1529,29 +1246,29 @@ void saturn_state::stv_vdp1_draw_scaled_sprite(const rectangle &cliprect)
 	int x2,y2;
 	int screen_width,screen_height,screen_height_negative = 0;
 
-	direction = (stv2_current_sprite.CMDCTRL & 0x0030)>>4;
+	direction = (rs.sprite.CMDCTRL & 0x0030)>>4;
 
-	xsize = (stv2_current_sprite.CMDSIZE & 0x3f00) >> 8;
+	xsize = (rs.sprite.CMDSIZE & 0x3f00) >> 8;
 	xsize = xsize * 8;
 
-	ysize = (stv2_current_sprite.CMDSIZE & 0x00ff);
+	ysize = (rs.sprite.CMDSIZE & 0x00ff);
 
-	patterndata = (stv2_current_sprite.CMDSRCA) & 0xffff;
+	patterndata = (rs.sprite.CMDSRCA) & 0xffff;
 	patterndata = patterndata * 0x8;
 
-	zoompoint = (stv2_current_sprite.CMDCTRL & 0x0f00)>>8;
+	zoompoint = (rs.sprite.CMDCTRL & 0x0f00)>>8;
 
-	x = stv2_current_sprite.CMDXA;
-	y = stv2_current_sprite.CMDYA;
+	x = rs.sprite.CMDXA;
+	y = rs.sprite.CMDYA;
 
-	screen_width = (INT16)stv2_current_sprite.CMDXB;
+	screen_width = (INT16)rs.sprite.CMDXB;
 	if ( (screen_width < 0) && zoompoint)
 	{
 		screen_width = -screen_width;
 		direction |= 1;
 	}
 
-	screen_height = (INT16)stv2_current_sprite.CMDYB;
+	screen_height = (INT16)rs.sprite.CMDYB;
 	if ( (screen_height < 0) && zoompoint )
 	{
 		screen_height_negative = 1;
@@ -1559,8 +1276,8 @@ void saturn_state::stv_vdp1_draw_scaled_sprite(const rectangle &cliprect)
 		direction |= 2;
 	}
 
-	x2 = stv2_current_sprite.CMDXC; // second co-ordinate set x
-	y2 = stv2_current_sprite.CMDYC; // second co-ordinate set y
+	x2 = rs.sprite.CMDXC; // second co-ordinate set x
+	y2 = rs.sprite.CMDYC; // second co-ordinate set y
 
 	switch (zoompoint)
 	{
@@ -1615,14 +1332,14 @@ void saturn_state::stv_vdp1_draw_scaled_sprite(const rectangle &cliprect)
 
 	if (zoompoint)
 	{
-		q[0].x = x2s(x);
-		q[0].y = y2s(y);
-		q[1].x = x2s(x)+screen_width;
-		q[1].y = y2s(y);
-		q[2].x = x2s(x)+screen_width;
-		q[2].y = y2s(y)+screen_height;
-		q[3].x = x2s(x);
-		q[3].y = y2s(y)+screen_height;
+		q[0].x = x2s(rs, x);
+		q[0].y = y2s(rs, y);
+		q[1].x = x2s(rs, x)+screen_width;
+		q[1].y = y2s(rs, y);
+		q[2].x = x2s(rs, x)+screen_width;
+		q[2].y = y2s(rs, y)+screen_height;
+		q[3].x = x2s(rs, x);
+		q[3].y = y2s(rs, y)+screen_height;
 
 		if ( screen_height_negative )
 		{
@@ -1634,14 +1351,14 @@ void saturn_state::stv_vdp1_draw_scaled_sprite(const rectangle &cliprect)
 	}
 	else
 	{
-		q[0].x = x2s(x);
-		q[0].y = y2s(y);
-		q[1].x = x2s(x2);
-		q[1].y = y2s(y);
-		q[2].x = x2s(x2);
-		q[2].y = y2s(y2);
-		q[3].x = x2s(x);
-		q[3].y = y2s(y2);
+		q[0].x = x2s(rs, x);
+		q[0].y = y2s(rs, y);
+		q[1].x = x2s(rs, x2);
+		q[1].y = y2s(rs, y);
+		q[2].x = x2s(rs, x2);
+		q[2].y = y2s(rs, y2);
+		q[3].x = x2s(rs, x);
+		q[3].y = y2s(rs, y2);
 	}
 
 
@@ -1660,14 +1377,14 @@ void saturn_state::stv_vdp1_draw_scaled_sprite(const rectangle &cliprect)
 		q[2].v = q[3].v = ysize-1;
 	}
 
-	stv_vdp1_setup_shading(q, cliprect);
-	vdp1_fill_quad(cliprect, patterndata, xsize, q);
+	stv_vdp1_setup_shading(rs, q, cliprect);
+	vdp1_fill_quad(rs, cliprect, patterndata, xsize, q);
 }
 
 
 
 
-void saturn_state::stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sprite_type)
+void saturn_state::stv_vdp1_draw_normal_sprite(stv_vdp1_raster &rs, const rectangle &cliprect, int sprite_type)
 {
 	int y, ysize, drawypos;
 	int x, xsize, drawxpos;
@@ -1677,17 +1394,17 @@ void saturn_state::stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sp
 	int su, u, dux, duy;
 	int maxdrawypos, maxdrawxpos;
 
-	x = x2s(stv2_current_sprite.CMDXA);
-	y = y2s(stv2_current_sprite.CMDYA);
+	x = x2s(rs, rs.sprite.CMDXA);
+	y = y2s(rs, rs.sprite.CMDYA);
 
-	direction = (stv2_current_sprite.CMDCTRL & 0x0030)>>4;
+	direction = (rs.sprite.CMDCTRL & 0x0030)>>4;
 
-	xsize = (stv2_current_sprite.CMDSIZE & 0x3f00) >> 8;
+	xsize = (rs.sprite.CMDSIZE & 0x3f00) >> 8;
 	xsize = xsize * 8;
 
-	ysize = (stv2_current_sprite.CMDSIZE & 0x00ff);
+	ysize = (rs.sprite.CMDSIZE & 0x00ff);
 
-	patterndata = (stv2_current_sprite.CMDSRCA) & 0xffff;
+	patterndata = (rs.sprite.CMDSRCA) & 0xffff;
 	patterndata = patterndata * 0x8;
 
 	if (VDP1_LOG) logerror ("Drawing Normal Sprite x %04x y %04x xsize %04x ysize %04x patterndata %06x\n",x,y,xsize,ysize,patterndata);
@@ -1695,7 +1412,7 @@ void saturn_state::stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sp
 	if ( x > cliprect.max_x ) return;
 	if ( y > cliprect.max_y ) return;
 
-	shading = stv_read_gouraud_table();
+	shading = stv_read_gouraud_table(rs);
 	if ( shading )
 	{
 		struct spoint q[4];
@@ -1704,7 +1421,7 @@ void saturn_state::stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sp
 		q[2].x = x + xsize; q[2].y = y + ysize;
 		q[3].x = x; q[3].y = y + ysize;
 
-		stv_vdp1_setup_shading( q, cliprect );
+		stv_vdp1_setup_shading(rs, q, cliprect );
 	}
 
 	u = 0;
@@ -1740,7 +1457,7 @@ void saturn_state::stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sp
 		su = u;
 		for (drawxpos = x; drawxpos <= maxdrawxpos; drawxpos++ )
 		{
-			(this->*drawpixel)( drawxpos, drawypos, patterndata, u );
+			(this->*rs.drawpixel)(rs, drawxpos, drawypos, patterndata, u );
 			u += dux;
 		}
 		u = su + duy;
@@ -1768,6 +1485,7 @@ void saturn_state::stv_vdp1_process_list( void )
 	int spritecount;
 	int vdp1_nest;
 	rectangle *cliprect;
+	stv_vdp2_sprite_list sprite;
 
 	spritecount = 0;
 	position = 0;
@@ -1776,7 +1494,7 @@ void saturn_state::stv_vdp1_process_list( void )
 
 	vdp1_nest = -1;
 
-	stv_clear_gouraud_shading();
+	m_vdp1_draw_list.clear();
 
 	/*Set CEF bit to 0*/
 	CEF_0;
@@ -1795,47 +1513,47 @@ void saturn_state::stv_vdp1_process_list( void )
 
 		spritecount++;
 
-		stv2_current_sprite.CMDCTRL = (m_vdp1_vram[position * (0x20/4)+0] & 0xffff0000) >> 16;
+		sprite.CMDCTRL = (m_vdp1_vram[position * (0x20/4)+0] & 0xffff0000) >> 16;
 
-		if (stv2_current_sprite.CMDCTRL == 0x8000)
+		if (sprite.CMDCTRL == 0x8000)
 		{
 			if (VDP1_LOG) logerror ("List Terminator (0x8000) Encountered, Sprite List Process END\n");
 			goto end; // end of list
 		}
 
-		stv2_current_sprite.CMDLINK = (m_vdp1_vram[position * (0x20/4)+0] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDPMOD = (m_vdp1_vram[position * (0x20/4)+1] & 0xffff0000) >> 16;
-		stv2_current_sprite.CMDCOLR = (m_vdp1_vram[position * (0x20/4)+1] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDSRCA = (m_vdp1_vram[position * (0x20/4)+2] & 0xffff0000) >> 16;
-		stv2_current_sprite.CMDSIZE = (m_vdp1_vram[position * (0x20/4)+2] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDXA   = (m_vdp1_vram[position * (0x20/4)+3] & 0xffff0000) >> 16;
-		stv2_current_sprite.CMDYA   = (m_vdp1_vram[position * (0x20/4)+3] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDXB   = (m_vdp1_vram[position * (0x20/4)+4] & 0xffff0000) >> 16;
-		stv2_current_sprite.CMDYB   = (m_vdp1_vram[position * (0x20/4)+4] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDXC   = (m_vdp1_vram[position * (0x20/4)+5] & 0xffff0000) >> 16;
-		stv2_current_sprite.CMDYC   = (m_vdp1_vram[position * (0x20/4)+5] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDXD   = (m_vdp1_vram[position * (0x20/4)+6] & 0xffff0000) >> 16;
-		stv2_current_sprite.CMDYD   = (m_vdp1_vram[position * (0x20/4)+6] & 0x0000ffff) >> 0;
-		stv2_current_sprite.CMDGRDA = (m_vdp1_vram[position * (0x20/4)+7] & 0xffff0000) >> 16;
-//      stv2_current_sprite.UNUSED  = (m_vdp1_vram[position * (0x20/4)+7] & 0x0000ffff) >> 0;
+		sprite.CMDLINK = (m_vdp1_vram[position * (0x20/4)+0] & 0x0000ffff) >> 0;
+		sprite.CMDPMOD = (m_vdp1_vram[position * (0x20/4)+1] & 0xffff0000) >> 16;
+		sprite.CMDCOLR = (m_vdp1_vram[position * (0x20/4)+1] & 0x0000ffff) >> 0;
+		sprite.CMDSRCA = (m_vdp1_vram[position * (0x20/4)+2] & 0xffff0000) >> 16;
+		sprite.CMDSIZE = (m_vdp1_vram[position * (0x20/4)+2] & 0x0000ffff) >> 0;
+		sprite.CMDXA   = (m_vdp1_vram[position * (0x20/4)+3] & 0xffff0000) >> 16;
+		sprite.CMDYA   = (m_vdp1_vram[position * (0x20/4)+3] & 0x0000ffff) >> 0;
+		sprite.CMDXB   = (m_vdp1_vram[position * (0x20/4)+4] & 0xffff0000) >> 16;
+		sprite.CMDYB   = (m_vdp1_vram[position * (0x20/4)+4] & 0x0000ffff) >> 0;
+		sprite.CMDXC   = (m_vdp1_vram[position * (0x20/4)+5] & 0xffff0000) >> 16;
+		sprite.CMDYC   = (m_vdp1_vram[position * (0x20/4)+5] & 0x0000ffff) >> 0;
+		sprite.CMDXD   = (m_vdp1_vram[position * (0x20/4)+6] & 0xffff0000) >> 16;
+		sprite.CMDYD   = (m_vdp1_vram[position * (0x20/4)+6] & 0x0000ffff) >> 0;
+		sprite.CMDGRDA = (m_vdp1_vram[position * (0x20/4)+7] & 0xffff0000) >> 16;
+//      sprite.UNUSED  = (m_vdp1_vram[position * (0x20/4)+7] & 0x0000ffff) >> 0;
 
 		/* proecess jump / skip commands, set position for next sprite */
-		switch (stv2_current_sprite.CMDCTRL & 0x7000)
+		switch (sprite.CMDCTRL & 0x7000)
 		{
 			case 0x0000: // jump next
 				if (VDP1_LOG) logerror ("Sprite List Process + Next (Normal)\n");
 				position++;
 				break;
 			case 0x1000: // jump assign
-				if (VDP1_LOG) logerror ("Sprite List Process + Jump Old %06x New %06x\n", position, (stv2_current_sprite.CMDLINK>>2));
-				position= (stv2_current_sprite.CMDLINK>>2);
+				if (VDP1_LOG) logerror ("Sprite List Process + Jump Old %06x New %06x\n", position, (sprite.CMDLINK>>2));
+				position= (sprite.CMDLINK>>2);
 				break;
 			case 0x2000: // jump call
 				if (vdp1_nest == -1)
 				{
-					if (VDP1_LOG) logerror ("Sprite List Process + Call Old %06x New %06x\n",position, (stv2_current_sprite.CMDLINK>>2));
+					if (VDP1_LOG) logerror ("Sprite List Process + Call Old %06x New %06x\n",position, (sprite.CMDLINK>>2));
 					vdp1_nest = position+1;
-					position = (stv2_current_sprite.CMDLINK>>2);
+					position = (sprite.CMDLINK>>2);
 				}
 				else
 				{
@@ -1862,19 +1580,19 @@ void saturn_state::stv_vdp1_process_list( void )
 				position++;
 				break;
 			case 0x5000:
-				if (VDP1_LOG) logerror ("Sprite List Skip + Jump Old %06x New %06x\n", position, (stv2_current_sprite.CMDLINK>>2));
+				if (VDP1_LOG) logerror ("Sprite List Skip + Jump Old %06x New %06x\n", position, (sprite.CMDLINK>>2));
 				draw_this_sprite = 0;
-				position= (stv2_current_sprite.CMDLINK>>2);
+				position= (sprite.CMDLINK>>2);
 
 				break;
 			case 0x6000:
 				draw_this_sprite = 0;
 				if (vdp1_nest == -1)
 				{
-					if (VDP1_LOG) logerror ("Sprite List Skip + Call To Subroutine Old %06x New %06x\n",position, (stv2_current_sprite.CMDLINK>>2));
+					if (VDP1_LOG) logerror ("Sprite List Skip + Call To Subroutine Old %06x New %06x\n",position, (sprite.CMDLINK>>2));
 
 					vdp1_nest = position+1;
-					position = (stv2_current_sprite.CMDLINK>>2);
+					position = (sprite.CMDLINK>>2);
 				}
 				else
 				{
@@ -1903,9 +1621,9 @@ void saturn_state::stv_vdp1_process_list( void )
 		/* continue to draw this sprite only if the command wasn't to skip it */
 		if (draw_this_sprite ==1)
 		{
-			if ( stv2_current_sprite.CMDPMOD & 0x0400 )
+			if ( sprite.CMDPMOD & 0x0400 )
 			{
-				//if(stv2_current_sprite.CMDPMOD & 0x0200) /* TODO: Bio Hazard inventory screen uses outside cliprect */
+				//if(sprite.CMDPMOD & 0x0200) /* TODO: Bio Hazard inventory screen uses outside cliprect */
 				//  cliprect = &m_vdp1.system_cliprect;
 				//else
 					cliprect = &m_vdp1.user_cliprect;
@@ -1915,75 +1633,74 @@ void saturn_state::stv_vdp1_process_list( void )
 				cliprect = &m_vdp1.system_cliprect;
 			}
 
-			stv_vdp1_set_drawpixel();
-
-			switch (stv2_current_sprite.CMDCTRL & 0x000f)
+			switch (sprite.CMDCTRL & 0x000f)
 			{
 				case 0x0000:
-					if (VDP1_LOG) logerror ("Sprite List Normal Sprite (%d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
-					stv2_current_sprite.ispoly = 0;
-					stv_vdp1_draw_normal_sprite(*cliprect, 0);
+					if (VDP1_LOG) logerror ("Sprite List Normal Sprite (%d %d)\n",sprite.CMDXA,sprite.CMDYA);
+					sprite.ispoly = 0;
+					stv_vdp1_queue_command(sprite, *cliprect);
 					break;
 
 				case 0x0001:
-					if (VDP1_LOG) logerror ("Sprite List Scaled Sprite (%d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
-					stv2_current_sprite.ispoly = 0;
-					stv_vdp1_draw_scaled_sprite(*cliprect);
+					if (VDP1_LOG) logerror ("Sprite List Scaled Sprite (%d %d)\n",sprite.CMDXA,sprite.CMDYA);
+					sprite.ispoly = 0;
+					stv_vdp1_queue_command(sprite, *cliprect);
 					break;
 
 				case 0x0002:
 				case 0x0003: // used by Hardcore 4x4
 					if (VDP1_LOG) logerror ("Sprite List Distorted Sprite\n");
-					if (VDP1_LOG) logerror ("(A: %d %d)\n",stv2_current_sprite.CMDXA,stv2_current_sprite.CMDYA);
-					if (VDP1_LOG) logerror ("(B: %d %d)\n",stv2_current_sprite.CMDXB,stv2_current_sprite.CMDYB);
-					if (VDP1_LOG) logerror ("(C: %d %d)\n",stv2_current_sprite.CMDXC,stv2_current_sprite.CMDYC);
-					if (VDP1_LOG) logerror ("(D: %d %d)\n",stv2_current_sprite.CMDXD,stv2_current_sprite.CMDYD);
-					if (VDP1_LOG) logerror ("CMDPMOD = %04x\n",stv2_current_sprite.CMDPMOD);
-
-					stv2_current_sprite.ispoly = 0;
-					stv_vdp1_draw_distorted_sprite(*cliprect);
+					if (VDP1_LOG) logerror ("(A: %d %d)\n",sprite.CMDXA,sprite.CMDYA);
+					if (VDP1_LOG) logerror ("(B: %d %d)\n",sprite.CMDXB,sprite.CMDYB);
+					if (VDP1_LOG) logerror ("(C: %d %d)\n",sprite.CMDXC,sprite.CMDYC);
+					if (VDP1_LOG) logerror ("(D: %d %d)\n",sprite.CMDXD,sprite.CMDYD);
+					if (VDP1_LOG) logerror ("CMDPMOD = %04x\n",sprite.CMDPMOD);
+
+					sprite.ispoly = 0;
+					stv_vdp1_queue_command(sprite, *cliprect);
 					break;
 
 				case 0x0004:
 					if (VDP1_LOG) logerror ("Sprite List Polygon\n");
-					stv2_current_sprite.ispoly = 1;
-					stv_vdp1_draw_distorted_sprite(*cliprect);
+					sprite.ispoly = 1;
+					stv_vdp1_queue_command(sprite, *cliprect);
 					break;
 
 				case 0x0005:
 //              case 0x0007: // mirror? Baroque uses it, crashes for whatever reason
 					if (VDP1_LOG) logerror ("Sprite List Polyline\n");
-					stv2_current_sprite.ispoly = 1;
-					stv_vdp1_draw_poly_line(*cliprect);
+					sprite.ispoly = 1;
+					stv_vdp1_queue_command(sprite, *cliprect);
 					break;
 
 				case 0x0006:
 					if (VDP1_LOG) logerror ("Sprite List Line\n");
-					stv2_current_sprite.ispoly = 1;
-					stv_vdp1_draw_line(*cliprect);
+					sprite.ispoly = 1;
+					stv_vdp1_queue_command(sprite, *cliprect);
 					break;
 
 				case 0x0008:
 //              case 0x000b: // mirror? Bug 2
-					if (VDP1_LOG) logerror ("Sprite List Set Command for User Clipping (%d,%d),(%d,%d)\n", stv2_current_sprite.CMDXA, stv2_current_sprite.CMDYA, stv2_current_sprite.CMDXC, stv2_current_sprite.CMDYC);
-					m_vdp1.user_cliprect.set(stv2_current_sprite.CMDXA, stv2_current_sprite.CMDXC, stv2_current_sprite.CMDYA, stv2_current_sprite.CMDYC);
+					if (VDP1_LOG) logerror ("Sprite List Set Command for User Clipping (%d,%d),(%d,%d)\n", sprite.CMDXA, sprite.CMDYA, sprite.CMDXC, sprite.CMDYC);
+					m_vdp1.user_cliprect.set(sprite.CMDXA, sprite.CMDXC, sprite.CMDYA, sprite.CMDYC);
 					break;
 
 				case 0x0009:
-					if (VDP1_LOG) logerror ("Sprite List Set Command for System Clipping (0,0),(%d,%d)\n", stv2_current_sprite.CMDXC, stv2_current_sprite.CMDYC);
-					m_vdp1.system_cliprect.set(0, stv2_current_sprite.CMDXC, 0, stv2_current_sprite.CMDYC);
+					if (VDP1_LOG) logerror ("Sprite List Set Command for System Clipping (0,0),(%d,%d)\n", sprite.CMDXC, sprite.CMDYC);
+					m_vdp1.system_cliprect.set(0, sprite.CMDXC, 0, sprite.CMDYC);
 					break;
 
 				case 0x000a:
-					if (VDP1_LOG) logerror ("Sprite List Local Co-Ordinate Set (%d %d)\n",(INT16)stv2_current_sprite.CMDXA,(INT16)stv2_current_sprite.CMDYA);
-					m_vdp1.local_x = (INT16)stv2_current_sprite.CMDXA;
-					m_vdp1.local_y = (INT16)stv2_current_sprite.CMDYA;
+					if (VDP1_LOG) logerror ("Sprite List Local Co-Ordinate Set (%d %d)\n",(INT16)sprite.CMDXA,(INT16)sprite.CMDYA);
+					m_vdp1.local_x = (INT16)sprite.CMDXA;
+					m_vdp1.local_y = (INT16)sprite.CMDYA;
 					break;
 
 				default:
-					popmessage ("VDP1: Sprite List Illegal %02x, contact MAMEdev",stv2_current_sprite.CMDCTRL & 0xf);
+					popmessage ("VDP1: Sprite List Illegal %02x, contact MAMEdev",sprite.CMDCTRL & 0xf);
 					m_vdp1.lopr = (position * 0x20) >> 3;
 					m_vdp1.copr = (position * 0x20) >> 3;
+					stv_vdp1_draw_list();
 					return;
 			}
 		}
@@ -1994,12 +1711,138 @@ void saturn_state::stv_vdp1_process_list( void )
 	end:
 	m_vdp1.copr = (position * 0x20) >> 3;
 
+	stv_vdp1_draw_list();
+
 	/* TODO: what's the exact formula? Guess it should be a mix between number of pixels written and actual command data fetched. */
 	machine().scheduler().timer_set(m_maincpu->cycles_to_attotime(spritecount*16), timer_expired_delegate(FUNC(saturn_state::vdp1_draw_end),this));
 
 	if (VDP1_LOG) logerror ("End of list processing!\n");
 }
 
+/* record a drawing command along with the clipping and local co-ordinates it was issued with */
+void saturn_state::stv_vdp1_queue_command(const stv_vdp2_sprite_list &sprite, const rectangle &cliprect)
+{
+	stv_vdp1_command cmd;
+
+	cmd.sprite = sprite;
+	cmd.cliprect = cliprect;
+	cmd.local_x = m_vdp1.local_x;
+	cmd.local_y = m_vdp1.local_y;
+	m_vdp1_draw_list.push_back(cmd);
+}
+
+void saturn_state::stv_vdp1_draw_command(stv_vdp1_raster &rs, const stv_vdp1_command &cmd)
+{
+	rectangle cliprect = cmd.cliprect;
+
+	/* only the lines this rasterizer owns */
+	cliprect.min_y = MAX(cliprect.min_y, rs.min_y);
+	cliprect.max_y = MIN(cliprect.max_y, rs.max_y);
+
+	rs.sprite = cmd.sprite;
+	rs.local_x = cmd.local_x;
+	rs.local_y = cmd.local_y;
+	stv_vdp1_set_drawpixel(rs);
+
+	switch (rs.sprite.CMDCTRL & 0x000f)
+	{
+		case 0x0000:
+			stv_vdp1_draw_normal_sprite(rs, cliprect, 0);
+			break;
+
+		case 0x0001:
+			stv_vdp1_draw_scaled_sprite(rs, cliprect);
+			break;
+
+		case 0x0002:
+		case 0x0003:
+		case 0x0004:
+			stv_vdp1_draw_distorted_sprite(rs, cliprect);
+			break;
+
+		case 0x0005:
+			stv_vdp1_draw_poly_line(rs, cliprect);
+			break;
+
+		case 0x0006:
+			stv_vdp1_draw_line(rs, cliprect);
+			break;
+	}
+}
+
+void saturn_state::stv_vdp1_draw_commands(stv_vdp1_raster &rs)
+{
+	stv_clear_gouraud_shading(rs);
+
+	for (const stv_vdp1_command &cmd : m_vdp1_draw_list)
+		stv_vdp1_draw_command(rs, cmd);
+}
+
+void *saturn_state::stv_vdp1_draw_band(void *param, int threadid)
+{
+	stv_vdp1_band *band = (stv_vdp1_band *)param;
+	if (band->claimed.exchange(true))
+		return nullptr;
+	band->rs.state->stv_vdp1_draw_commands(band->rs);
+	return nullptr;
+}
+
+/*
+   Rasterize the draw list gathered by stv_vdp1_process_list. Every command
+   touches only framebuffer lines inside its clipping rectangle, and the
+   gouraud scanline for a line is only set up and used by that line, so
+   bands of lines can each replay the whole list on a worker without seeing
+   each other. Within a band commands still land in list order, which keeps
+   half-transparency, shadow and mesh identical to drawing on one thread.
+*/
+void saturn_state::stv_vdp1_draw_list( void )
+{
+	bool banded = m_vdp1_queue != nullptr && m_vdp1.framebuffer_height > STV_VDP1_BAND_LINES;
+
+	if (m_vdp1_draw_list.empty())
+		return;
+
+	for (const stv_vdp1_command &cmd : m_vdp1_draw_list)
+	{
+		/* a clip past the framebuffer wraps into other lines, and illegal colour modes draw from machine().rand() */
+		if (cmd.cliprect.max_x >= m_vdp1.framebuffer_width || cmd.cliprect.max_y >= m_vdp1.framebuffer_height)
+			banded = false;
+		if (!cmd.sprite.ispoly && (cmd.sprite.CMDPMOD & 0x0038) > 0x0028)
+			banded = false;
+	}
+
+	if (!banded)
+	{
+		stv_vdp1_raster rs;
+		rs.state = this;
+		rs.min_y = 0;
+		rs.max_y = 511;
+		stv_vdp1_draw_commands(rs);
+		return;
+	}
+
+	m_vdp1_bands.resize((m_vdp1.framebuffer_height + STV_VDP1_BAND_LINES - 1) / STV_VDP1_BAND_LINES);
+	for (int band = 0; band < (int)m_vdp1_bands.size(); band++)
+	{
+		stv_vdp1_raster &rs = m_vdp1_bands[band].rs;
+		rs.state = this;
+		rs.min_y = band * STV_VDP1_BAND_LINES;
+		rs.max_y = std::min(rs.min_y + STV_VDP1_BAND_LINES, m_vdp1.framebuffer_height) - 1;
+		m_vdp1_bands[band].claimed = false;
+	}
+
+	osd_work_item_queue_multiple(m_vdp1_queue, stv_vdp1_draw_band, m_vdp1_bands.size(), &m_vdp1_bands[0], sizeof(stv_vdp1_band), WORK_ITEM_FLAG_AUTO_RELEASE);
+
+	/* if the queue times out, draw the bands no worker has started here; the list can't change under one still drawing */
+	if (!osd_work_queue_wait(m_vdp1_queue, osd_ticks_per_second() * 100))
+	{
+		for (stv_vdp1_band &band : m_vdp1_bands)
+			stv_vdp1_draw_band(&band, 0);
+		if (!osd_work_queue_wait(m_vdp1_queue, osd_ticks_per_second() * 100))
+			throw emu_fatalerror("stv_vdp1_draw_list: work queue stalled");
+	}
+}
+
 void saturn_state::video_update_vdp1( void )
 {
 	int framebuffer_changed = 0;
@@ -2117,14 +1960,25 @@ void saturn_state::stv_vdp1_state_save_postload( void )
 	}
 }
 
+void saturn_state::stv_vdp1_exit ( void )
+{
+	if (m_vdp1_queue != nullptr)
+		osd_work_queue_free(m_vdp1_queue);
+	m_vdp1_queue = nullptr;
+}
+
 int saturn_state::stv_vdp1_start ( void )
 {
+	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(saturn_state::stv_vdp1_exit), this));
+
 	m_vdp1_regs = make_unique_clear<UINT16[]>(0x020/2 );
 	m_vdp1_vram = make_unique_clear<UINT32[]>(0x100000/4 );
 	m_vdp1.gfx_decode = std::make_unique<UINT8[]>(0x100000 );
 
 	stv_vdp1_shading_data = std::make_unique<struct stv_vdp1_poly_scanline_data>();
 
+	m_vdp1_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
 	m_vdp1.framebuffer[0] = std::make_unique<UINT16[]>(1024 * 256 * 2 ); /* *2 is for double interlace */
 	m_vdp1.framebuffer[1] = std::make_unique<UINT16[]>(1024 * 256 * 2 );
 
@@ -0,0 +1,322 @@
+// license:LGPL-2.1+
+// copyright-holders:David Haywood, Angelo Salese, Olivier Galibert, Mariusz Wojcieszek, R. Belmont
+/***************************************************************************
+
+    stvvdp1fill.h
+
+    Sega VDP1 quad scan conversion. Every line of a quad comes out the
+    same whatever the clipping rectangle, so a band of lines clipped out
+    of the framebuffer draws exactly what drawing the whole quad would.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __STVVDP1FILL_H__
+#define __STVVDP1FILL_H__
+
+enum { FRAC_SHIFT = 16 };
+
+struct spoint {
+	INT32 x, y;
+	INT32 u, v;
+};
+
+template<typename _DrawPixel>
+static inline void vdp1_fill_slope(const rectangle &cliprect, int patterndata, int xsize,
+							INT32 x1, INT32 x2, INT32 sl1, INT32 sl2, INT32 *nx1, INT32 *nx2,
+							INT32 u1, INT32 u2, INT32 slu1, INT32 slu2, INT32 *nu1, INT32 *nu2,
+							INT32 v1, INT32 v2, INT32 slv1, INT32 slv2, INT32 *nv1, INT32 *nv2,
+							INT32 _y1, INT32 y2, const _DrawPixel &drawpixel)
+{
+	INT32 yend;
+
+	/* the edges still have to reach y2 when the slope is clipped: with the
+	   vertices out of order the next slope can climb back into the clip */
+	if(_y1 > cliprect.max_y || y2 <= cliprect.min_y) {
+		int delta = (y2 > _y1) ? y2-_y1 : 0;
+		*nx1 = x1+delta*sl1;
+		*nu1 = u1+delta*slu1;
+		*nv1 = v1+delta*slv1;
+		*nx2 = x2+delta*sl2;
+		*nu2 = u2+delta*slu2;
+		*nv2 = v2+delta*slv2;
+		return;
+	}
+
+	if(x1 > x2 || (x1==x2 && sl1 > sl2)) {
+		INT32 t, *tp;
+		t = x1;
+		x1 = x2;
+		x2 = t;
+		t = sl1;
+		sl1 = sl2;
+		sl2 = t;
+		tp = nx1;
+		nx1 = nx2;
+		nx2 = tp;
+
+		t = u1;
+		u1 = u2;
+		u2 = t;
+		t = slu1;
+		slu1 = slu2;
+		slu2 = t;
+		tp = nu1;
+		nu1 = nu2;
+		nu2 = tp;
+
+		t = v1;
+		v1 = v2;
+		v2 = t;
+		t = slv1;
+		slv1 = slv2;
+		slv2 = t;
+		tp = nv1;
+		nv1 = nv2;
+		nv2 = tp;
+	}
+
+	/* edges are ordered where the slope starts, not where the clip does, so
+	   edges crossing inside a slope draw the same lines whatever the clip */
+	yend = (y2 > cliprect.max_y) ? cliprect.max_y+1 : y2;
+	if(_y1 < cliprect.min_y) {
+		int delta = cliprect.min_y - _y1;
+		x1 += delta*sl1;
+		u1 += delta*slu1;
+		v1 += delta*slv1;
+		x2 += delta*sl2;
+		u2 += delta*slu2;
+		v2 += delta*slv2;
+		_y1 = cliprect.min_y;
+	}
+
+	while(_y1 < yend) {
+		if(_y1 >= cliprect.min_y) {
+			INT32 slux = 0, slvx = 0;
+			int xx1 = x1>>FRAC_SHIFT;
+			int xx2 = x2>>FRAC_SHIFT;
+			INT32 u = u1;
+			INT32 v = v1;
+			if(xx1 != xx2) {
+				int delta = xx2-xx1;
+				slux = (u2-u1)/delta;
+				slvx = (v2-v1)/delta;
+			}
+			if(xx1 <= cliprect.max_x || xx2 >= cliprect.min_x) {
+				if(xx1 < cliprect.min_x) {
+					int delta = cliprect.min_x-xx1;
+					u += slux*delta;
+					v += slvx*delta;
+					xx1 = cliprect.min_x;
+				}
+				if(xx2 > cliprect.max_x)
+					xx2 = cliprect.max_x;
+
+				while(xx1 <= xx2) {
+					drawpixel(xx1,_y1, patterndata, (v>>FRAC_SHIFT)*xsize+(u>>FRAC_SHIFT));
+					xx1++;
+					u += slux;
+					v += slvx;
+				}
+			}
+		}
+
+		x1 += sl1;
+		u1 += slu1;
+		v1 += slv1;
+		x2 += sl2;
+		u2 += slu2;
+		v2 += slv2;
+		_y1++;
+	}
+	if(_y1 < y2) {
+		int delta = y2-_y1;
+		x1 += delta*sl1;
+		u1 += delta*slu1;
+		v1 += delta*slv1;
+		x2 += delta*sl2;
+		u2 += delta*slu2;
+		v2 += delta*slv2;
+	}
+	*nx1 = x1;
+	*nu1 = u1;
+	*nv1 = v1;
+	*nx2 = x2;
+	*nu2 = u2;
+	*nv2 = v2;
+}
+
+template<typename _DrawPixel>
+static inline void vdp1_fill_line(const rectangle &cliprect, int patterndata, int xsize, INT32 y,
+							INT32 x1, INT32 x2, INT32 u1, INT32 u2, INT32 v1, INT32 v2, const _DrawPixel &drawpixel)
+{
+	int xx1 = x1>>FRAC_SHIFT;
+	int xx2 = x2>>FRAC_SHIFT;
+
+	if(y > cliprect.max_y || y < cliprect.min_y)
+		return;
+
+	if(xx1 <= cliprect.max_x || xx2 >= cliprect.min_x) {
+		INT32 slux = 0, slvx = 0;
+		INT32 u = u1;
+		INT32 v = v1;
+		if(xx1 != xx2) {
+			int delta = xx2-xx1;
+			slux = (u2-u1)/delta;
+			slvx = (v2-v1)/delta;
+		}
+		if(xx1 < cliprect.min_x) {
+			int delta = cliprect.min_x-xx1;
+			u += slux*delta;
+			v += slvx*delta;
+			xx1 = cliprect.min_x;
+		}
+		if(xx2 > cliprect.max_x)
+			xx2 = cliprect.max_x;
+
+		while(xx1 <= xx2) {
+			drawpixel(xx1,y,patterndata,(v>>FRAC_SHIFT)*xsize+(u>>FRAC_SHIFT));
+			xx1++;
+			u += slux;
+			v += slvx;
+		}
+	}
+}
+
+template<typename _DrawPixel>
+static inline void vdp1_fill_quad(const rectangle &cliprect, int patterndata, int xsize, const struct spoint *q, const _DrawPixel &drawpixel)
+{
+	INT32 sl1, sl2, slu1, slu2, slv1, slv2, cury, limy, x1, x2, u1, u2, v1, v2, delta;
+	int pmin, pmax, i, ps1, ps2;
+	struct spoint p[8];
+
+	for(i=0; i<4; i++) {
+		p[i].x = p[i+4].x = q[i].x << FRAC_SHIFT;
+		p[i].y = p[i+4].y = q[i].y;
+		p[i].u = p[i+4].u = q[i].u << FRAC_SHIFT;
+		p[i].v = p[i+4].v = q[i].v << FRAC_SHIFT;
+	}
+
+	pmin = pmax = 0;
+	for(i=1; i<4; i++) {
+		if(p[i].y < p[pmin].y)
+			pmin = i;
+		if(p[i].y > p[pmax].y)
+			pmax = i;
+	}
+
+	cury = p[pmin].y;
+	limy = p[pmax].y;
+
+	if(cury == limy) {
+		x1 = x2 = p[0].x;
+		u1 = u2 = p[0].u;
+		v1 = v2 = p[0].v;
+		for(i=1; i<4; i++) {
+			if(p[i].x < x1) {
+				x1 = p[i].x;
+				u1 = p[i].u;
+				v1 = p[i].v;
+			}
+			if(p[i].x > x2) {
+				x2 = p[i].x;
+				u2 = p[i].u;
+				v2 = p[i].v;
+			}
+		}
+		vdp1_fill_line(cliprect, patterndata, xsize, cury, x1, x2, u1, u2, v1, v2, drawpixel);
+		return;
+	}
+
+	if(cury > cliprect.max_y)
+		return;
+	if(limy < cliprect.min_y)
+		return;
+
+	ps1 = pmin+4;
+	ps2 = pmin;
+
+	goto startup;
+
+	for(;;) {
+		if(p[ps1-1].y == p[ps2+1].y) {
+			vdp1_fill_slope(cliprect, patterndata, xsize,
+							x1, x2, sl1, sl2, &x1, &x2,
+							u1, u2, slu1, slu2, &u1, &u2,
+							v1, v2, slv1, slv2, &v1, &v2,
+							cury, p[ps1-1].y, drawpixel);
+			cury = p[ps1-1].y;
+			if(cury >= limy)
+				break;
+			ps1--;
+			ps2++;
+
+		startup:
+			while(p[ps1-1].y == cury)
+				ps1--;
+			while(p[ps2+1].y == cury)
+				ps2++;
+			x1 = p[ps1].x;
+			u1 = p[ps1].u;
+			v1 = p[ps1].v;
+			x2 = p[ps2].x;
+			u2 = p[ps2].u;
+			v2 = p[ps2].v;
+
+			delta = cury-p[ps1-1].y;
+			sl1 = (x1-p[ps1-1].x)/delta;
+			slu1 = (u1-p[ps1-1].u)/delta;
+			slv1 = (v1-p[ps1-1].v)/delta;
+
+			delta = cury-p[ps2+1].y;
+			sl2 = (x2-p[ps2+1].x)/delta;
+			slu2 = (u2-p[ps2+1].u)/delta;
+			slv2 = (v2-p[ps2+1].v)/delta;
+		} else if(p[ps1-1].y < p[ps2+1].y) {
+			vdp1_fill_slope(cliprect, patterndata, xsize,
+							x1, x2, sl1, sl2, &x1, &x2,
+							u1, u2, slu1, slu2, &u1, &u2,
+							v1, v2, slv1, slv2, &v1, &v2,
+							cury, p[ps1-1].y, drawpixel);
+			cury = p[ps1-1].y;
+			if(cury >= limy)
+				break;
+			ps1--;
+			while(p[ps1-1].y == cury)
+				ps1--;
+			x1 = p[ps1].x;
+			u1 = p[ps1].u;
+			v1 = p[ps1].v;
+
+			delta = cury-p[ps1-1].y;
+			sl1 = (x1-p[ps1-1].x)/delta;
+			slu1 = (u1-p[ps1-1].u)/delta;
+			slv1 = (v1-p[ps1-1].v)/delta;
+		} else {
+			vdp1_fill_slope(cliprect, patterndata, xsize,
+							x1, x2, sl1, sl2, &x1, &x2,
+							u1, u2, slu1, slu2, &u1, &u2,
+							v1, v2, slv1, slv2, &v1, &v2,
+							cury, p[ps2+1].y, drawpixel);
+			cury = p[ps2+1].y;
+			if(cury >= limy)
+				break;
+			ps2++;
+			while(p[ps2+1].y == cury)
+				ps2++;
+			x2 = p[ps2].x;
+			u2 = p[ps2].u;
+			v2 = p[ps2].v;
+
+			delta = cury-p[ps2+1].y;
+			sl2 = (x2-p[ps2+1].x)/delta;
+			slu2 = (u2-p[ps2+1].u)/delta;
+			slv2 = (v2-p[ps2+1].v)/delta;
+		}
+	}
+	if(cury == limy)
+		vdp1_fill_line(cliprect, patterndata, xsize, cury, x1, x2, u1, u2, v1, v2, drawpixel);
+}
+
+#endif  /* __STVVDP1FILL_H__ */
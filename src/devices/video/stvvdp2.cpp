@@ -4503,6 +4503,81 @@ void saturn_state::stv_vdp2_check_tilemap(bitmap_rgb32 &bitmap, const rectangle
 }
 
 
+/* lines per work item when copying a rotated plane */
+#define STV_VDP2_ROZ_BAND_LINES     16
+
+/* fetch a rotation coefficient at table position kaddr; returns its MSB, set when the dot isn't drawn */
+static inline int stv_vdp2_read_roz_coeff(const UINT32 *coeff_table_base, UINT32 coeff_table_offset, int coeff_table_size, UINT32 kaddr, INT32 *coeff)
+{
+	UINT32 address;
+	INT32 coeff_table_val;
+	int coeff_msb;
+
+	switch( coeff_table_size )
+	{
+		case 0:
+			address = coeff_table_offset + (kaddr >> 16) * 4;
+			coeff_table_val = coeff_table_base[ address / 4 ];
+			//coeff_line_color_screen_data = (coeff_table_val & 0x7f000000) >> 24;
+			coeff_msb = (coeff_table_val & 0x80000000) > 0;
+			if ( coeff_table_val & 0x00800000 )
+			{
+				coeff_table_val |= 0xff000000;
+			}
+			else
+			{
+				coeff_table_val &= 0x007fffff;
+			}
+			break;
+		case 1:
+			address = coeff_table_offset + (kaddr >> 16) * 2;
+			coeff_table_val = coeff_table_base[ address / 4 ];
+			if ( (address & 2) == 0 )
+			{
+				coeff_table_val >>= 16;
+			}
+			coeff_table_val &= 0xffff;
+			//coeff_line_color_screen_data = 0;
+			coeff_msb = (coeff_table_val & 0x8000) > 0;
+			if ( coeff_table_val & 0x4000 )
+			{
+				coeff_table_val |= 0xffff8000;
+			}
+			else
+			{
+				coeff_table_val &= 0x3fff;
+			}
+			coeff_table_val <<= 6; /* to form 16.16 fixed point val */
+			break;
+		default:
+			coeff_table_val = 0;
+			coeff_msb = 1;
+			break;
+	}
+
+	*coeff = coeff_table_val;
+	return coeff_msb;
+}
+
+static inline void stv_vdp2_apply_roz_coeff(int coeff_table_mode, INT32 coeff_table_val, INT32 *kx, INT32 *ky, INT32 *xp)
+{
+	switch( coeff_table_mode )
+	{
+		case 0:
+			*kx = *ky = coeff_table_val;
+			break;
+		case 1:
+			*kx = coeff_table_val;
+			break;
+		case 2:
+			*ky = coeff_table_val;
+			break;
+		case 3:
+			*xp = coeff_table_val;
+			break;
+	}
+}
+
 void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 										bitmap_rgb32 &roz_bitmap,
 										const rectangle &cliprect,
@@ -4512,19 +4587,13 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 										int planerenderedsizex,
 										int planerenderedsizey)
 {
-	INT32 xsp, ysp, xp, yp, dx, dy, x, y, xs, ys, dxs, dys;
-	INT32 vcnt, hcnt;
+	stv_vdp2_roz_copy &copy = m_vdp2_roz_copy;
+	INT32 xp, yp;
 	INT32 kx, ky;
 	INT8  use_coeff_table, coeff_table_mode, coeff_table_size, coeff_table_shift;
 	INT8  screen_over_process;
 	UINT8 vcnt_shift, hcnt_shift;
-	UINT8 coeff_msb;
 	UINT32 *coeff_table_base, coeff_table_offset;
-	INT32 coeff_table_val;
-	UINT32 address;
-	UINT32 *line;
-	rgb_t pix;
-	//UINT32 coeff_line_color_screen_data;
 	INT32 clipxmask = 0, clipymask = 0;
 
 
@@ -4541,7 +4610,6 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 
 	use_coeff_table = coeff_table_mode = coeff_table_size = coeff_table_shift = 0;
 	coeff_table_offset = 0;
-	coeff_table_val = 0;
 	coeff_table_base = nullptr;
 
 	if ( LOG_ROZ == 1 ) logerror( "Rendering RBG with parameter %s\n", iRP == 1 ? "A" : "B" );
@@ -4631,14 +4699,115 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 
 	//dx  = (RP.A * RP.dx) + (RP.B * RP.dy);
 	//dy  = (RP.D * RP.dx) + (RP.E * RP.dy);
-	dx = mul_fixed32( RP.A, RP.dx ) + mul_fixed32( RP.B, RP.dy );
-	dy = mul_fixed32( RP.D, RP.dx ) + mul_fixed32( RP.E, RP.dy );
+	copy.dx = mul_fixed32( RP.A, RP.dx ) + mul_fixed32( RP.B, RP.dy );
+	copy.dy = mul_fixed32( RP.D, RP.dx ) + mul_fixed32( RP.E, RP.dy );
 
 	//xp  = RP.A * ( RP.px - RP.cx ) + RP.B * ( RP.py - RP.cy ) + RP.C * ( RP.pz - RP.cz ) + RP.cx + RP.mx;
 	//yp  = RP.D * ( RP.px - RP.cx ) + RP.E * ( RP.py - RP.cy ) + RP.F * ( RP.pz - RP.cz ) + RP.cy + RP.my;
 	xp = mul_fixed32( RP.A, RP.px - RP.cx ) + mul_fixed32( RP.B, RP.py - RP.cy ) + mul_fixed32( RP.C, RP.pz - RP.cz ) + RP.cx + RP.mx;
 	yp = mul_fixed32( RP.D, RP.px - RP.cx ) + mul_fixed32( RP.E, RP.py - RP.cy ) + mul_fixed32( RP.F, RP.pz - RP.cz ) + RP.cy + RP.my;
 
+	copy.bitmap = &bitmap;
+	copy.yp = yp;
+	copy.roz_bitmap = &roz_bitmap;
+	copy.use_coeff_table = use_coeff_table;
+	copy.coeff_table_mode = coeff_table_mode;
+	copy.coeff_table_size = coeff_table_size;
+	copy.coeff_table_base = coeff_table_base;
+	copy.coeff_table_offset = coeff_table_offset;
+	copy.vcnt_shift = vcnt_shift;
+	copy.hcnt_shift = hcnt_shift;
+	copy.clipxmask = clipxmask;
+	copy.clipymask = clipymask;
+	copy.planerenderedsizex = planerenderedsizex;
+	copy.planerenderedsizey = planerenderedsizey;
+
+	if ( m_vdp2_roz_queue == nullptr || cliprect.height() <= STV_VDP2_ROZ_BAND_LINES )
+	{
+		stv_vdp2_copy_roz_rows(cliprect, kx, ky, xp);
+		return;
+	}
+
+	/*
+	   Lines are independent apart from the coefficient state: a coefficient
+	   read with its MSB clear replaces kx, ky or xp for everything after it.
+	   One pass down the lines records the state each band starts from, so
+	   the bands can run in any order and still match a top-to-bottom copy.
+	   Only the last such read on a line matters, so each line is searched
+	   from the right.
+	*/
+	m_vdp2_roz_bands.clear();
+	for (INT32 vcnt = cliprect.min_y; vcnt <= cliprect.max_y; vcnt++ )
+	{
+		if ( (vcnt - cliprect.min_y) % STV_VDP2_ROZ_BAND_LINES == 0 )
+		{
+			stv_vdp2_roz_band band;
+			band.state = this;
+			band.clip.set(cliprect.min_x, cliprect.max_x, vcnt, std::min(vcnt + STV_VDP2_ROZ_BAND_LINES - 1, cliprect.max_y));
+			band.kx = kx;
+			band.ky = ky;
+			band.xp = xp;
+			m_vdp2_roz_bands.push_back(band);
+		}
+
+		if ( use_coeff_table )
+		{
+			UINT32 line_kaddr = RP.kast + RP.dkast*(vcnt>>vcnt_shift);
+			INT32 coeff_table_val;
+
+			if ( RP.dkax == 0 )
+			{
+				if ( !stv_vdp2_read_roz_coeff(coeff_table_base, coeff_table_offset, coeff_table_size, line_kaddr, &coeff_table_val) )
+					stv_vdp2_apply_roz_coeff(coeff_table_mode, coeff_table_val, &kx, &ky, &xp);
+			}
+			else
+			{
+				for (INT32 hcnt = cliprect.max_x; hcnt >= cliprect.min_x; hcnt-- )
+				{
+					if ( !stv_vdp2_read_roz_coeff(coeff_table_base, coeff_table_offset, coeff_table_size, line_kaddr + RP.dkax*hcnt, &coeff_table_val) )
+					{
+						stv_vdp2_apply_roz_coeff(coeff_table_mode, coeff_table_val, &kx, &ky, &xp);
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	osd_work_item_queue_multiple(m_vdp2_roz_queue, stv_vdp2_copy_roz_band, m_vdp2_roz_bands.size(), &m_vdp2_roz_bands[0], sizeof(stv_vdp2_roz_band), WORK_ITEM_FLAG_AUTO_RELEASE);
+	if (!osd_work_queue_wait(m_vdp2_roz_queue, osd_ticks_per_second() * 100))
+	{
+		/* copy whichever bands no worker has claimed, then wait for the rest */
+		for (stv_vdp2_roz_band &band : m_vdp2_roz_bands)
+			stv_vdp2_copy_roz_band(&band, 0);
+		if (!osd_work_queue_wait(m_vdp2_roz_queue, osd_ticks_per_second() * 100))
+			throw emu_fatalerror("stv_vdp2_copy_roz_bitmap: work queue stalled");
+	}
+}
+
+void *saturn_state::stv_vdp2_copy_roz_band(void *param, int threadid)
+{
+	stv_vdp2_roz_band *band = (stv_vdp2_roz_band *)param;
+	if (band->claimed.exchange(true))
+		return nullptr;
+	band->state->stv_vdp2_copy_roz_rows(band->clip, band->kx, band->ky, band->xp);
+	return nullptr;
+}
+
+void saturn_state::stv_vdp2_copy_roz_rows(const rectangle &cliprect, INT32 kx, INT32 ky, INT32 xp)
+{
+	const stv_vdp2_roz_copy &copy = m_vdp2_roz_copy;
+	bitmap_rgb32 &roz_bitmap = *copy.roz_bitmap;
+	const INT32 dx = copy.dx, dy = copy.dy, yp = copy.yp;
+	const UINT8 vcnt_shift = copy.vcnt_shift, hcnt_shift = copy.hcnt_shift;
+	const INT32 clipxmask = copy.clipxmask, clipymask = copy.clipymask;
+	const int planerenderedsizex = copy.planerenderedsizex, planerenderedsizey = copy.planerenderedsizey;
+	INT32 xsp, ysp, x, y, xs, ys, dxs, dys;
+	INT32 vcnt, hcnt;
+	INT32 coeff_table_val;
+	UINT32 *line;
+	rgb_t pix;
+
 	for (vcnt = cliprect.min_y; vcnt <= cliprect.max_y; vcnt++ )
 	{
 		/*xsp = RP.A * ( ( RP.xst + RP.dxst * (vcnt << 16) ) - RP.px ) +
@@ -4658,69 +4827,14 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 		//dx  = (RP.A * RP.dx) + (RP.B * RP.dy);
 		//dy  = (RP.D * RP.dx) + (RP.E * RP.dy);
 
-		line = &bitmap.pix32(vcnt);
+		line = &copy.bitmap->pix32(vcnt);
 
-		if ( !use_coeff_table || RP.dkax == 0 )
+		if ( !copy.use_coeff_table || RP.dkax == 0 )
 		{
-			if ( use_coeff_table )
+			if ( copy.use_coeff_table )
 			{
-				switch( coeff_table_size )
-				{
-					case 0:
-						address = coeff_table_offset + ((RP.kast + RP.dkast*(vcnt>>vcnt_shift)) >> 16) * 4;
-						coeff_table_val = coeff_table_base[ address / 4 ];
-						//coeff_line_color_screen_data = (coeff_table_val & 0x7f000000) >> 24;
-						coeff_msb = (coeff_table_val & 0x80000000) > 0;
-						if ( coeff_table_val & 0x00800000 )
-						{
-							coeff_table_val |= 0xff000000;
-						}
-						else
-						{
-							coeff_table_val &= 0x007fffff;
-						}
-						break;
-					case 1:
-						address = coeff_table_offset + ((RP.kast + RP.dkast*(vcnt>>vcnt_shift)) >> 16) * 2;
-						coeff_table_val = coeff_table_base[ address / 4 ];
-						if ( (address & 2) == 0 )
-						{
-							coeff_table_val >>= 16;
-						}
-						coeff_table_val &= 0xffff;
-						//coeff_line_color_screen_data = 0;
-						coeff_msb = (coeff_table_val & 0x8000) > 0;
-						if ( coeff_table_val & 0x4000 )
-						{
-							coeff_table_val |= 0xffff8000;
-						}
-						else
-						{
-							coeff_table_val &= 0x3fff;
-						}
-						coeff_table_val <<= 6; /* to form 16.16 fixed point val */
-						break;
-					default:
-						coeff_msb = 1;
-						break;
-				}
-				if ( coeff_msb ) continue;
-
-				switch( coeff_table_mode )
-				{
-					case 0:
-						kx = ky = coeff_table_val;
-						break;
-					case 1:
-						kx = coeff_table_val;
-						break;
-					case 2:
-						ky = coeff_table_val;
-						break;
-					case 3:
-						xp = coeff_table_val;
-						break;
-				}
+				if ( stv_vdp2_read_roz_coeff(copy.coeff_table_base, copy.coeff_table_offset, copy.coeff_table_size, RP.kast + RP.dkast*(vcnt>>vcnt_shift), &coeff_table_val) ) continue;
+				stv_vdp2_apply_roz_coeff(copy.coeff_table_mode, coeff_table_val, &kx, &ky, &xp);
 			}
 
 			//x = RP.kx * ( xsp + dx * (hcnt << 16)) + xp;
@@ -4780,62 +4894,8 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 		{
 			for (hcnt = cliprect.min_x; hcnt <= cliprect.max_x; hcnt++ )
 			{
-				switch( coeff_table_size )
-				{
-					case 0:
-						address = coeff_table_offset + ((RP.kast + RP.dkast*(vcnt>>vcnt_shift) + RP.dkax*hcnt) >> 16) * 4;
-						coeff_table_val = coeff_table_base[ address / 4 ];
-						//coeff_line_color_screen_data = (coeff_table_val & 0x7f000000) >> 24;
-						coeff_msb = (coeff_table_val & 0x80000000) > 0;
-						if ( coeff_table_val & 0x00800000 )
-						{
-							coeff_table_val |= 0xff000000;
-						}
-						else
-						{
-							coeff_table_val &= 0x007fffff;
-						}
-						break;
-					case 1:
-						address = coeff_table_offset + ((RP.kast + RP.dkast*(vcnt>>vcnt_shift) + RP.dkax*hcnt) >> 16) * 2;
-						coeff_table_val = coeff_table_base[ address / 4 ];
-						if ( (address & 2) == 0 )
-						{
-							coeff_table_val >>= 16;
-						}
-						coeff_table_val &= 0xffff;
-						//coeff_line_color_screen_data = 0;
-						coeff_msb = (coeff_table_val & 0x8000) > 0;
-						if ( coeff_table_val & 0x4000 )
-						{
-							coeff_table_val |= 0xffff8000;
-						}
-						else
-						{
-							coeff_table_val &= 0x3fff;
-						}
-						coeff_table_val <<= 6; /* to form 16.16 fixed point val */
-						break;
-					default:
-						coeff_msb = 1;
-						break;
-				}
-				if ( coeff_msb ) continue;
-				switch( coeff_table_mode )
-				{
-					case 0:
-						kx = ky = coeff_table_val;
-						break;
-					case 1:
-						kx = coeff_table_val;
-						break;
-					case 2:
-						ky = coeff_table_val;
-						break;
-					case 3:
-						xp = coeff_table_val;
-						break;
-				}
+				if ( stv_vdp2_read_roz_coeff(copy.coeff_table_base, copy.coeff_table_offset, copy.coeff_table_size, RP.kast + RP.dkast*(vcnt>>vcnt_shift) + RP.dkax*hcnt, &coeff_table_val) ) continue;
+				stv_vdp2_apply_roz_coeff(copy.coeff_table_mode, coeff_table_val, &kx, &ky, &xp);
 
 				//x = RP.kx * ( xsp + dx * (hcnt << 16)) + xp;
 				//y = RP.ky * ( ysp + dy * (hcnt << 16)) + yp;
@@ -6093,6 +6153,10 @@ void saturn_state::stv_vdp2_state_save_postload( void )
 
 void saturn_state::stv_vdp2_exit ( void )
 {
+	if (m_vdp2_roz_queue != nullptr)
+		osd_work_queue_free(m_vdp2_roz_queue);
+	m_vdp2_roz_queue = nullptr;
+
 	m_vdp2.roz_bitmap[0].reset();
 	m_vdp2.roz_bitmap[1].reset();
 }
@@ -6106,6 +6170,8 @@ int saturn_state::stv_vdp2_start ( void )
 	m_vdp2_cram = make_unique_clear<UINT32[]>(0x080000/4 );
 	m_vdp2.gfx_decode = std::make_unique<UINT8[]>(0x100000 );
 
+	m_vdp2_roz_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
 //  m_gfxdecode->gfx(0)->granularity()=4;
 //  m_gfxdecode->gfx(1)->granularity()=4;
 
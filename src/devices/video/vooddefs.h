@@ -631,16 +631,17 @@ do
 }                                                                               \
 while (0)
 
-static inline bool ATTR_FORCE_INLINE chromaKeyTest(voodoo_device *vd, stats_block *stats, UINT32 fbzModeReg, rgbaint_t rgbaIntColor)
+template<typename _RegArray>
+static inline bool ATTR_FORCE_INLINE chromaKeyTest(const _RegArray &reg, stats_block *stats, UINT32 fbzModeReg, rgbaint_t rgbaIntColor)
 {
 	if (FBZMODE_ENABLE_CHROMAKEY(fbzModeReg))
 	{
 		rgb_union color;
 		color.u = (rgbaIntColor.get_a()<<24) | (rgbaIntColor.get_r()<<16) | (rgbaIntColor.get_g()<<8) | rgbaIntColor.get_b();
 		/* non-range version */
-		if (!CHROMARANGE_ENABLE(vd->reg[chromaRange].u))
+		if (!CHROMARANGE_ENABLE(reg[chromaRange].u))
 		{
-			if (((color.u ^ vd->reg[chromaKey].u) & 0xffffff) == 0)
+			if (((color.u ^ reg[chromaKey].u) & 0xffffff) == 0)
 			{
 				stats->chroma_fail++;
 				return false;
@@ -654,30 +655,30 @@ static inline bool ATTR_FORCE_INLINE chromaKeyTest(voodoo_device *vd, stats_bloc
 			int results;
 
 			/* check blue */
-			low = vd->reg[chromaKey].rgb.b;
-			high = vd->reg[chromaRange].rgb.b;
+			low = reg[chromaKey].rgb.b;
+			high = reg[chromaRange].rgb.b;
 			test = color.rgb.b;
 			results = (test >= low && test <= high);
-			results ^= CHROMARANGE_BLUE_EXCLUSIVE(vd->reg[chromaRange].u);
+			results ^= CHROMARANGE_BLUE_EXCLUSIVE(reg[chromaRange].u);
 			results <<= 1;
 
 			/* check green */
-			low = vd->reg[chromaKey].rgb.g;
-			high = vd->reg[chromaRange].rgb.g;
+			low = reg[chromaKey].rgb.g;
+			high = reg[chromaRange].rgb.g;
 			test = color.rgb.g;
 			results |= (test >= low && test <= high);
-			results ^= CHROMARANGE_GREEN_EXCLUSIVE(vd->reg[chromaRange].u);
+			results ^= CHROMARANGE_GREEN_EXCLUSIVE(reg[chromaRange].u);
 			results <<= 1;
 
 			/* check red */
-			low = vd->reg[chromaKey].rgb.r;
-			high = vd->reg[chromaRange].rgb.r;
+			low = reg[chromaKey].rgb.r;
+			high = reg[chromaRange].rgb.r;
 			test = color.rgb.r;
 			results |= (test >= low && test <= high);
-			results ^= CHROMARANGE_RED_EXCLUSIVE(vd->reg[chromaRange].u);
+			results ^= CHROMARANGE_RED_EXCLUSIVE(reg[chromaRange].u);
 
 			/* final result */
-			if (CHROMARANGE_UNION_MODE(vd->reg[chromaRange].u))
+			if (CHROMARANGE_UNION_MODE(reg[chromaRange].u))
 			{
 				if (results != 0)
 				{
@@ -806,11 +807,12 @@ do
 }                                                                               \
 while (0)
 
-static inline bool ATTR_FORCE_INLINE alphaTest(voodoo_device *vd, stats_block *stats, UINT32 alphaModeReg, UINT8 alpha)
+template<typename _RegArray>
+static inline bool ATTR_FORCE_INLINE alphaTest(const _RegArray &reg, stats_block *stats, UINT32 alphaModeReg, UINT8 alpha)
 {
 	if (ALPHAMODE_ALPHATEST(alphaModeReg))
 	{
-		UINT8 alpharef = vd->reg[alphaMode].rgb.a;
+		UINT8 alpharef = reg[alphaMode].rgb.a;
 		switch (ALPHAMODE_ALPHAFUNCTION(alphaModeReg))
 		{
 			case 0:     /* alphaOP = never */
@@ -1353,7 +1355,8 @@ do
 }                                                                               \
 while (0)
 
-static inline void ATTR_FORCE_INLINE applyFogging(voodoo_device *vd, UINT32 fogModeReg, UINT32 fbzCpReg,  INT32 x, const UINT8 *dither4, INT32 fogDepth,
+template<typename _RegArray>
+static inline void ATTR_FORCE_INLINE applyFogging(voodoo_device *vd, const _RegArray &reg, UINT32 fogModeReg, UINT32 fbzCpReg,  INT32 x, const UINT8 *dither4, INT32 fogDepth,
 	rgbaint_t &color, INT32 iterz, INT64 iterw, UINT8 itera)
 {
 	if (FOGMODE_ENABLE_FOG(fogModeReg))
@@ -1361,7 +1364,7 @@ static inline void ATTR_FORCE_INLINE applyFogging(voodoo_device *vd, UINT32 fogM
 		UINT32 color_alpha = color.get_a();
 
 		/* constant fog bypasses everything else */
-		rgbaint_t fogColorLocal(vd->reg[fogColor].u);
+		rgbaint_t fogColorLocal(reg[fogColor].u);
 
 		if (FOGMODE_FOG_CONSTANT(fogModeReg))
 		{
@@ -1828,7 +1831,7 @@ while (0)
  *
  *************************************/
 
-#define PIXEL_PIPELINE_BEGIN(vd, STATS, XX, YY, FBZCOLORPATH, FBZMODE, ITERZ, ITERW)    \
+#define PIXEL_PIPELINE_BEGIN(vd, REGS, STATS, XX, YY, FBZCOLORPATH, FBZMODE, ITERZ, ITERW) \
 do                                                                              \
 {                                                                               \
 	INT32 depthval, wfloat, fogdepth, biasdepth;                                  \
@@ -1883,7 +1886,7 @@ do
 	/* add the bias for fog selection*/                                         \
 	if (FBZMODE_ENABLE_DEPTH_BIAS(FBZMODE))                                     \
 	{                                                                           \
-		fogdepth += (INT16)vd->reg[zaColor].u;                                \
+		fogdepth += (INT16)(REGS)[zaColor].u;                                 \
 		CLAMP(fogdepth, 0, 0xffff);                                             \
 	}                                                                           \
 																				\
@@ -1914,12 +1917,12 @@ do
 	biasdepth = depthval;                                                     \
 	if (FBZMODE_ENABLE_DEPTH_BIAS(FBZMODE))                                     \
 	{                                                                           \
-		biasdepth += (INT16)vd->reg[zaColor].u;                                \
+		biasdepth += (INT16)(REGS)[zaColor].u;                                \
 		CLAMP(biasdepth, 0, 0xffff);                                             \
 	}
 
 
-#define DEPTH_TEST(vd, STATS, XX, FBZMODE)    \
+#define DEPTH_TEST(vd, REGS, STATS, XX, FBZMODE) \
 do                                                                              \
 {                                                                               \
 	/* handle depth buffer testing */                                           \
@@ -1932,7 +1935,7 @@ do
 		if (FBZMODE_DEPTH_SOURCE_COMPARE(FBZMODE) == 0)                         \
 			depthsource = biasdepth;                                             \
 		else                                                                    \
-			depthsource = (UINT16)vd->reg[zaColor].u;                         \
+			depthsource = (UINT16)(REGS)[zaColor].u;                          \
 																				\
 		/* test against the depth buffer */                                     \
 		switch (FBZMODE_DEPTH_FUNCTION(FBZMODE))                                \
@@ -2072,11 +2075,11 @@ static inline bool ATTR_FORCE_INLINE depthTest(UINT16 zaColorReg, stats_block *s
 	return true;
 }
 
-#define PIXEL_PIPELINE_END(vd, STATS, DITHER, DITHER4, DITHER_LOOKUP, XX, dest, depth, FBZMODE, FBZCOLORPATH, ALPHAMODE, FOGMODE, ITERZ, ITERW, ITERAXXX) \
+#define PIXEL_PIPELINE_END(vd, REGS, STATS, DITHER, DITHER4, DITHER_LOOKUP, XX, dest, depth, FBZMODE, FBZCOLORPATH, ALPHAMODE, FOGMODE, ITERZ, ITERW, ITERAXXX) \
 																				\
 	/* perform fogging */                                                       \
 	preFog.set(color); \
-	applyFogging(vd, FOGMODE, FBZCOLORPATH, XX, DITHER4, fogdepth, color, ITERZ, ITERW, ITERAXXX.get_a()); \
+	applyFogging(vd, REGS, FOGMODE, FBZCOLORPATH, XX, DITHER4, fogdepth, color, ITERZ, ITERW, ITERAXXX.get_a()); \
 	/* perform alpha blending */                                                \
 	alphaBlend(FBZMODE, ALPHAMODE, XX, DITHER, dest[XX], depth, preFog, color); \
 	a = color.get_a(); r = color.get_r(); g = color.get_g(); b = color.get_b();                     \
@@ -2407,7 +2410,8 @@ do
 }                                                                               \
 while (0)
 
-static inline bool ATTR_FORCE_INLINE combineColor(voodoo_device *vd, stats_block *STATS, UINT32 FBZCOLORPATH, UINT32 FBZMODE, UINT32 ALPHAMODE,
+template<typename _RegArray>
+static inline bool ATTR_FORCE_INLINE combineColor(const _RegArray &reg, stats_block *STATS, UINT32 FBZCOLORPATH, UINT32 FBZMODE, UINT32 ALPHAMODE,
 													rgbaint_t TEXELARGB, INT32 ITERZ, INT64 ITERW, rgbaint_t &srcColor)
 {
 	rgbaint_t c_other;
@@ -2425,7 +2429,7 @@ static inline bool ATTR_FORCE_INLINE combineColor(voodoo_device *vd, stats_block
 			break;
 
 		case 2:     /* color1 RGB */
-			c_other.set(vd->reg[color1].u);
+			c_other.set(reg[color1].u);
 			break;
 
 		default:    /* reserved - voodoo3 framebufferRGB */
@@ -2434,7 +2438,7 @@ static inline bool ATTR_FORCE_INLINE combineColor(voodoo_device *vd, stats_block
 	}
 
 	/* handle chroma key */
-	if (!chromaKeyTest(vd, STATS, FBZMODE, c_other))
+	if (!chromaKeyTest(reg, STATS, FBZMODE, c_other))
 		return false;
 	//APPLY_CHROMAKEY(vd->m_vds, STATS, FBZMODE, c_other);
 
@@ -2450,7 +2454,7 @@ static inline bool ATTR_FORCE_INLINE combineColor(voodoo_device *vd, stats_block
 			break;
 
 		case 2:     /* color1 alpha */
-			c_other.set_a(vd->reg[color1].rgb.a);
+			c_other.set_a(reg[color1].rgb.a);
 			break;
 
 		default:    /* reserved */
@@ -2470,14 +2474,14 @@ static inline bool ATTR_FORCE_INLINE combineColor(voodoo_device *vd, stats_block
 		if (FBZCP_CC_LOCALSELECT(FBZCOLORPATH) == 0)    /* iterated RGB */
 			c_local.set(srcColor);
 		else                                            /* color0 RGB */
-			c_local.set(vd->reg[color0].u);
+			c_local.set(reg[color0].u);
 	}
 	else
 	{
 		if (!(TEXELARGB.get_a() & 0x80))                  /* iterated RGB */
 			c_local.set(srcColor);
 		else                                            /* color0 RGB */
-			c_local.set(vd->reg[color0].u);
+			c_local.set(reg[color0].u);
 	}
 
 	/* compute a_local */
@@ -2489,7 +2493,7 @@ static inline bool ATTR_FORCE_INLINE combineColor(voodoo_device *vd, stats_block
 			break;
 
 		case 1:     /* color0 alpha */
-			c_local.set_a(vd->reg[color0].rgb.a);
+			c_local.set_a(reg[color0].rgb.a);
 			break;
 
 		case 2:     /* clamped iterated Z[27:20] */
@@ -2641,7 +2645,7 @@ static inline bool ATTR_FORCE_INLINE combineColor(voodoo_device *vd, stats_block
 
 
 	/* handle alpha test */
-	if (!alphaTest(vd, STATS, ALPHAMODE, srcColor.get_a()))
+	if (!alphaTest(reg, STATS, ALPHAMODE, srcColor.get_a()))
 		return false;
 	//APPLY_ALPHATEST(vd->m_vds, STATS, ALPHAMODE, color.rgb.a);
 
@@ -2691,8 +2695,8 @@ void voodoo_device::raster_##name(void *destbase, INT32 y, const poly_extent *ex
 		INT32 tempclip;                                                         \
 																				\
 		/* Y clipping buys us the whole scanline */                             \
-		if (scry < ((vd->reg[clipLowYHighY].u >> 16) & 0x3ff) ||                 \
-			scry >= (vd->reg[clipLowYHighY].u & 0x3ff))                          \
+		if (scry < ((extra->reg[clipLowYHighY].u >> 16) & 0x3ff) ||             \
+			scry >= (extra->reg[clipLowYHighY].u & 0x3ff))                      \
 		{                                                                       \
 			stats->pixels_in += stopx - startx;                                 \
 			stats->clip_fail += stopx - startx;                                 \
@@ -2700,14 +2704,14 @@ void voodoo_device::raster_##name(void *destbase, INT32 y, const poly_extent *ex
 		}                                                                       \
 																				\
 		/* X clipping */                                                        \
-		tempclip = (vd->reg[clipLeftRight].u >> 16) & 0x3ff;                     \
+		tempclip = (extra->reg[clipLeftRight].u >> 16) & 0x3ff;                 \
 		if (startx < tempclip)                                                  \
 		{                                                                       \
 			stats->pixels_in += tempclip - startx;                              \
 			vd->stats.total_clipped += tempclip - startx;                        \
 			startx = tempclip;                                                  \
 		}                                                                       \
-		tempclip = vd->reg[clipLeftRight].u & 0x3ff;                             \
+		tempclip = extra->reg[clipLeftRight].u & 0x3ff;                         \
 		if (stopx >= tempclip)                                                  \
 		{                                                                       \
 			stats->pixels_in += stopx - tempclip;                               \
@@ -2751,9 +2755,9 @@ void voodoo_device::raster_##name(void *destbase, INT32 y, const poly_extent *ex
 		rgbaint_t color, preFog;                                                \
 																				\
 		/* pixel pipeline part 1 handles depth setup and stippling */         \
-		PIXEL_PIPELINE_BEGIN(vd, stats, x, y, FBZCOLORPATH, FBZMODE, iterz, iterw); \
+		PIXEL_PIPELINE_BEGIN(vd, extra->reg, stats, x, y, FBZCOLORPATH, FBZMODE, iterz, iterw); \
 		/* depth testing */         \
-		if (!depthTest((UINT16) vd->reg[zaColor].u, stats, depth[x], FBZMODE, biasdepth)) \
+		if (!depthTest((UINT16) extra->reg[zaColor].u, stats, depth[x], FBZMODE, biasdepth)) \
 			goto skipdrawdepth; \
 																				\
 		/* run the texture pipeline on TMU1 to produce a value in texel */      \
@@ -2786,11 +2790,11 @@ void voodoo_device::raster_##name(void *destbase, INT32 y, const poly_extent *ex
 																				\
 		/* colorpath pipeline selects source colors and does blending */        \
 		color = clampARGB(iterargb, FBZCOLORPATH);           \
-		if (!combineColor(vd, stats, FBZCOLORPATH, FBZMODE, ALPHAMODE, texel, iterz, iterw, color)) \
+		if (!combineColor(extra->reg, stats, FBZCOLORPATH, FBZMODE, ALPHAMODE, texel, iterz, iterw, color)) \
 			goto skipdrawdepth; \
 																				\
 		/* pixel pipeline part 2 handles fog, alpha, and final output */        \
-		PIXEL_PIPELINE_END(vd, stats, dither, dither4, dither_lookup, x, dest, depth, \
+		PIXEL_PIPELINE_END(vd, extra->reg, stats, dither, dither4, dither_lookup, x, dest, depth, \
 							FBZMODE, FBZCOLORPATH, ALPHAMODE, FOGMODE,          \
 							iterz, iterw, iterargb);                            \
 																				\
@@ -2407,21 +2407,18 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 
 		/* mask off invalid bits for different cards */
 		case fbzColorPath:
-			poly_wait(vd->poly, vd->regnames[regnum]);
 			if (vd->vd_type < TYPE_VOODOO_2)
 				data &= 0x0fffffff;
 			if (chips & 1) vd->reg[fbzColorPath].u = data;
 			break;
 
 		case fbzMode:
-			poly_wait(vd->poly, vd->regnames[regnum]);
 			if (vd->vd_type < TYPE_VOODOO_2)
 				data &= 0x001fffff;
 			if (chips & 1) vd->reg[fbzMode].u = data;
 			break;
 
 		case fogMode:
-			poly_wait(vd->poly, vd->regnames[regnum]);
 			if (vd->vd_type < TYPE_VOODOO_2)
 				data &= 0x0000003f;
 			if (chips & 1) vd->reg[fogMode].u = data;
@@ -2834,17 +2831,9 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 			vd->send_config = (TREXINIT_SEND_TMU_CONFIG(data) > 0);
 			goto default_case;
 
-		/* these registers are referenced in the renderer; we must wait for pending work before changing */
-		case chromaRange:
-		case chromaKey:
-		case alphaMode:
-		case fogColor:
+		/* the renderer updates stipple as it goes; we must wait for pending work before changing */
+		/* the other registers it references are captured with each triangle (see capture_raster_regs) */
 		case stipple:
-		case zaColor:
-		case color1:
-		case color0:
-		case clipLowYHighY:
-		case clipLeftRight:
 			poly_wait(vd->poly, vd->regnames[regnum]);
 			/* fall through to default implementation */
 
@@ -3317,13 +3306,13 @@ INT32 voodoo_device::lfb_w(voodoo_device* vd, offs_t offset, UINT32 data, UINT32
 				color.set(sa[pix], sr[pix], sg[pix], sb[pix]);
 
 				/* handle chroma key */
-				if (!chromaKeyTest(vd, stats, vd->reg[fbzMode].u, color))
+				if (!chromaKeyTest(vd->reg, stats, vd->reg[fbzMode].u, color))
 					goto nextpixel;
 				/* handle alpha mask */
 				if (!alphaMaskTest(stats, vd->reg[fbzMode].u, color.get_a()))
 					goto nextpixel;
 				/* handle alpha test */
-				if (!alphaTest(vd, stats, vd->reg[alphaMode].u, color.get_a()))
+				if (!alphaTest(vd->reg, stats, vd->reg[alphaMode].u, color.get_a()))
 					goto nextpixel;
 
 
@@ -3331,7 +3320,7 @@ INT32 voodoo_device::lfb_w(voodoo_device* vd, offs_t offset, UINT32 data, UINT32
 				poly_wait(vd->poly, "LFB Write");
 
 				/* pixel pipeline part 2 handles color blending, fog, alpha, and final output */
-				PIXEL_PIPELINE_END(vd, stats, dither, dither4, dither_lookup, x, dest, depth,
+				PIXEL_PIPELINE_END(vd, vd->reg, stats, dither, dither4, dither_lookup, x, dest, depth,
 					vd->reg[fbzMode].u, vd->reg[fbzColorPath].u, vd->reg[alphaMode].u, vd->reg[fogMode].u,
 					iterz, iterw, iterargb);
 nextpixel:
@@ -5113,6 +5102,18 @@ void voodoo_device::common_start_voodoo(UINT8 type)
     COMMAND HANDLERS
 ***************************************************************************/
 
+/*-------------------------------------------------
+    capture_raster_regs - copy the registers the
+    rasterizers read into a work item, so they can
+    be rewritten while the item is still pending
+-------------------------------------------------*/
+
+static inline void capture_raster_regs(const voodoo_device *vd, poly_extra_data *extra)
+{
+	memcpy(extra->reg.reg, &vd->reg[fbzColorPath], sizeof(extra->reg.reg));
+}
+
+
 /*-------------------------------------------------
     fastfill - execute the 'fastfill'
     command
@@ -5183,6 +5184,7 @@ INT32 voodoo_device::fastfill(voodoo_device *vd)
 		int count = MIN(ey - y, ARRAY_LENGTH(extents));
 
 		extra->device= vd;
+		capture_raster_regs(vd, extra);
 		memcpy(extra->dither, dithermatrix, sizeof(extra->dither));
 
 		pixels += poly_render_triangle_custom(vd->poly, drawbuf, global_cliprect, raster_fastfill, y, count, extents);
@@ -5540,6 +5542,7 @@ INT32 voodoo_device::triangle_create_work_item(voodoo_device* vd, UINT16 *drawbu
 	/* fill in the extra data */
 	extra->device = vd;
 	extra->info = info;
+	capture_raster_regs(vd, extra);
 
 	/* fill in triangle parameters */
 	extra->ax = vd->fbi.ax;
@@ -5885,11 +5888,11 @@ void voodoo_device::raster_fastfill(void *destbase, INT32 y, const poly_extent *
 
 	/* determine the screen Y */
 	scry = y;
-	if (FBZMODE_Y_ORIGIN(vd->reg[fbzMode].u))
+	if (FBZMODE_Y_ORIGIN(extra->reg[fbzMode].u))
 		scry = (vd->fbi.yorigin - y) & 0x3ff;
 
 	/* fill this RGB row */
-	if (FBZMODE_RGB_BUFFER_MASK(vd->reg[fbzMode].u))
+	if (FBZMODE_RGB_BUFFER_MASK(extra->reg[fbzMode].u))
 	{
 		const UINT16 *ditherow = &extra->dither[(y & 3) * 4];
 		UINT64 expanded = *(UINT64 *)ditherow;
@@ -5905,9 +5908,9 @@ void voodoo_device::raster_fastfill(void *destbase, INT32 y, const poly_extent *
 	}
 
 	/* fill this dest buffer row */
-	if (FBZMODE_AUX_BUFFER_MASK(vd->reg[fbzMode].u) && vd->fbi.auxoffs != ~0)
+	if (FBZMODE_AUX_BUFFER_MASK(extra->reg[fbzMode].u) && vd->fbi.auxoffs != ~0)
 	{
-		UINT16 depth = vd->reg[zaColor].u;
+		UINT16 depth = extra->reg[zaColor].u;
 		UINT64 expanded = ((UINT64)depth << 48) | ((UINT64)depth << 32) | (depth << 16) | depth;
 		UINT16 *dest = (UINT16 *)(vd->fbi.ram + vd->fbi.auxoffs) + scry * vd->fbi.rowpixels;
 
@@ -5925,21 +5928,21 @@ void voodoo_device::raster_fastfill(void *destbase, INT32 y, const poly_extent *
     generic_0tmu - generic rasterizer for 0 TMUs
 -------------------------------------------------*/
 
-RASTERIZER(generic_0tmu, 0, vd->reg[fbzColorPath].u, vd->reg[fbzMode].u, vd->reg[alphaMode].u,
-			vd->reg[fogMode].u, 0, 0)
+RASTERIZER(generic_0tmu, 0, extra->reg[fbzColorPath].u, extra->reg[fbzMode].u, extra->reg[alphaMode].u,
+			extra->reg[fogMode].u, 0, 0)
 
 
 /*-------------------------------------------------
     generic_1tmu - generic rasterizer for 1 TMU
 -------------------------------------------------*/
 
-RASTERIZER(generic_1tmu, 1, vd->reg[fbzColorPath].u, vd->reg[fbzMode].u, vd->reg[alphaMode].u,
-			vd->reg[fogMode].u, vd->tmu[0].reg[textureMode].u, 0)
+RASTERIZER(generic_1tmu, 1, extra->reg[fbzColorPath].u, extra->reg[fbzMode].u, extra->reg[alphaMode].u,
+			extra->reg[fogMode].u, vd->tmu[0].reg[textureMode].u, 0)
 
 
 /*-------------------------------------------------
     generic_2tmu - generic rasterizer for 2 TMUs
 -------------------------------------------------*/
 
-RASTERIZER(generic_2tmu, 2, vd->reg[fbzColorPath].u, vd->reg[fbzMode].u, vd->reg[alphaMode].u,
-			vd->reg[fogMode].u, vd->tmu[0].reg[textureMode].u, vd->tmu[1].reg[textureMode].u)
+RASTERIZER(generic_2tmu, 2, extra->reg[fbzColorPath].u, extra->reg[fbzMode].u, extra->reg[alphaMode].u,
+			extra->reg[fogMode].u, vd->tmu[0].reg[textureMode].u, vd->tmu[1].reg[textureMode].u)
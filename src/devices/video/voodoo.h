@@ -1385,6 +1385,16 @@ union voodoo_reg
 };
 
 
+/* a copy of the registers fbzColorPath..color1, indexed by register number */
+struct voodoo_reg_window
+{
+	voodoo_reg &operator[](int index) { return reg[index - fbzColorPath]; }
+	const voodoo_reg &operator[](int index) const { return reg[index - fbzColorPath]; }
+
+	voodoo_reg          reg[color1 + 1 - fbzColorPath];
+};
+
+
 
 struct voodoo_stats
 {
@@ -1632,6 +1642,7 @@ struct poly_extra_data
 {
 	voodoo_device * device;
 	raster_info *       info;                   /* pointer to rasterizer information */
+	voodoo_reg_window   reg;                    /* fbzColorPath..color1 as of setup */
 
 	INT16               ax, ay;                 /* vertex A x,y (12.4) */
 	INT32               startr, startg, startb, starta; /* starting R,G,B,A (12.12) */
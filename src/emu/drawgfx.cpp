@@ -210,11 +210,17 @@ void gfx_element::set_layout(const gfx_layout &gl, const UINT8 *srcdata)
 	m_dirty.resize(m_total_elements);
 	memset(&m_dirty[0], 1, m_total_elements);
 
-	// allocate a pen usage array for entries with 32 pens or less
+	// allocate pen usage arrays for entries with 32 pens or less
 	if (m_color_depth <= 32)
+	{
 		m_pen_usage.resize(m_total_elements);
+		m_row_pen_usage.resize(m_total_elements * m_origheight);
+	}
 	else
+	{
 		m_pen_usage.clear();
+		m_row_pen_usage.clear();
+	}
 }
 
 
@@ -262,9 +268,12 @@ void gfx_element::set_source_and_total(const UINT8 *source, UINT32 total)
 	m_dirty.resize(m_total_elements);
 	memset(&m_dirty[0], 1, m_total_elements);
 
-	// allocate a pen usage array for entries with 32 pens or less
+	// allocate pen usage arrays for entries with 32 pens or less
 	if (m_color_depth <= 32)
+	{
 		m_pen_usage.resize(m_total_elements);
+		m_row_pen_usage.resize(m_total_elements * m_origheight);
+	}
 
 	if (m_layout_is_raw)
 	{
@@ -335,13 +344,17 @@ void gfx_element::decode(UINT32 code)
 	// (re)compute pen usage
 	if (code < m_pen_usage.size())
 	{
-		// iterate over data, creating a bitmask of live pens
+		// iterate over data, creating a bitmask of live pens for each row and overall
 		const UINT8 *dp = m_gfxdata + code * m_char_modulo;
+		UINT32 *rowusage = &m_row_pen_usage[code * m_origheight];
 		UINT32 usage = 0;
 		for (int y = 0; y < m_origheight; y++)
 		{
+			UINT32 row = 0;
 			for (int x = 0; x < m_origwidth; x++)
-				usage |= 1 << dp[x];
+				row |= 1 << dp[x];
+			rowusage[y] = row;
+			usage |= row;
 			dp += m_line_modulo;
 		}
 
@@ -370,7 +383,7 @@ void gfx_element::opaque(bitmap_ind16 &dest, const rectangle &cliprect,
 	color = colorbase() + granularity() * (color % colors());
 	code %= elements();
 	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_OPAQUE, NO_PRIORITY);
+	DRAWGFX_ROW_CORE(UINT16, PIXEL_OP_REBASE_OPAQUE, ROW_OP_REBASE_OPAQUE, NO_PRIORITY);
 }
 
 void gfx_element::opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -413,7 +426,7 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 	// render
 	color = colorbase() + granularity() * (color % colors());
 	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
+	DRAWGFX_ROW_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN, ROW_OP_REBASE_TRANSPEN, NO_PRIORITY);
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -441,7 +454,7 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
 	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN, NO_PRIORITY);
+	DRAWGFX_ROW_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN, ROW_OP_REMAP_TRANSPEN, NO_PRIORITY);
 }
 
 
@@ -462,7 +475,7 @@ void gfx_element::transpen_raw(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
+	DRAWGFX_ROW_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN, ROW_OP_REBASE_TRANSPEN, NO_PRIORITY);
 }
 
 void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -476,7 +489,7 @@ void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	DECLARE_NO_PRIORITY;
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
+	DRAWGFX_ROW_CORE(UINT32, PIXEL_OP_REBASE_TRANSPEN, ROW_OP_REBASE_TRANSPEN, NO_PRIORITY);
 }
 
 
@@ -923,7 +936,7 @@ void gfx_element::prio_opaque(bitmap_ind16 &dest, const rectangle &cliprect,
 	// render
 	color = colorbase() + granularity() * (color % colors());
 	code %= elements();
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_OPAQUE_PRIORITY, UINT8);
+	DRAWGFX_ROW_CORE(UINT16, PIXEL_OP_REBASE_OPAQUE_PRIORITY, ROW_OP_REBASE_OPAQUE_PRIORITY, UINT8);
 }
 
 void gfx_element::prio_opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -936,7 +949,7 @@ void gfx_element::prio_opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
 	code %= elements();
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_OPAQUE_PRIORITY, UINT8);
+	DRAWGFX_ROW_CORE(UINT32, PIXEL_OP_REMAP_OPAQUE_PRIORITY, ROW_OP_REMAP_OPAQUE_PRIORITY, UINT8);
 }
 
 
@@ -973,7 +986,7 @@ void gfx_element::prio_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
+	DRAWGFX_ROW_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, ROW_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
 }
 
 void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1003,7 +1016,7 @@ void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_PRIORITY, UINT8);
+	DRAWGFX_ROW_CORE(UINT32, PIXEL_OP_REMAP_TRANSPEN_PRIORITY, ROW_OP_REMAP_TRANSPEN_PRIORITY, UINT8);
 }
 
 
@@ -1026,7 +1039,7 @@ void gfx_element::prio_transpen_raw(bitmap_ind16 &dest, const rectangle &cliprec
 	pmask |= 1 << 31;
 
 	// render
-	DRAWGFX_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
+	DRAWGFX_ROW_CORE(UINT16, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, ROW_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
 }
 
 void gfx_element::prio_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -1042,7 +1055,7 @@ void gfx_element::prio_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprec
 	pmask |= 1 << 31;
 
 	// render
-	DRAWGFX_CORE(UINT32, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
+	DRAWGFX_ROW_CORE(UINT32, PIXEL_OP_REBASE_TRANSPEN_PRIORITY, ROW_OP_REBASE_TRANSPEN_PRIORITY, UINT8);
 }
 
 
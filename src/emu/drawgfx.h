@@ -192,6 +192,9 @@ public:
 		return m_gfxdata + code * m_char_modulo + m_starty * m_line_modulo + m_startx;
 	}
 
+	// true if data points into this element's pixels, as returned by get_data()
+	bool owns_data(const UINT8 *data) const { return data >= m_gfxdata && data < m_gfxdata + m_total_elements * m_char_modulo; }
+
 	UINT32 pen_usage(UINT32 code)
 	{
 		assert(code < m_pen_usage.size());
@@ -199,6 +202,17 @@ public:
 		return m_pen_usage[code];
 	}
 
+	// pen usage of each row of an element, starting at the source clip; nullptr if not tracked
+	// (RAW data can change behind our back, so it is only trusted for decoded layouts)
+	const UINT32 *row_pen_usage(UINT32 code)
+	{
+		if (m_row_pen_usage.empty() || m_layout_is_raw)
+			return nullptr;
+		assert(code < elements());
+		if (m_dirty[code]) decode(code);
+		return &m_row_pen_usage[code * m_origheight + m_starty];
+	}
+
 	// ----- core graphics drawing -----
 
 	// specific drawgfx implementations for each transparency type
@@ -294,6 +308,7 @@ private:
 	dynamic_buffer  m_gfxdata_allocated;    // allocated decoded pixel data, 8bpp
 	dynamic_buffer  m_dirty;                // dirty array for detecting chars that need decoding
 	std::vector<UINT32>  m_pen_usage;      // bitmask of pens that are used (pens 0-31 only)
+	std::vector<UINT32>  m_row_pen_usage;  // same, for each row of each element
 
 	bool            m_layout_is_raw;        // raw layout?
 	UINT8           m_layout_planes;        // bit planes in the layout
@@ -363,6 +363,233 @@ do
 while (0)
 
 
+/***************************************************************************
+    ROW OPERATIONS
+***************************************************************************/
+
+/*
+    The ROW_OP* macros render a complete unzoomed row of a gfx element at
+    once, using SSE2 where available. They take the same DEST, PRIORITY and
+    SOURCE pointers the core passes to PIXEL_OP* plus the number of pixels,
+    the source direction (1 or -1) and the pen usage of the source row (~0
+    if unknown), and evaluate to false if the row could not be handled, in
+    which case the core falls back to PIXEL_OP. Each one produces exactly
+    the same results as the PIXEL_OP it mirrors.
+
+    Rows that only use the transparent pen are skipped outright, and rows
+    that never use it are drawn without testing each pixel.
+*/
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define DRAWGFX_USE_SSE2        1
+#include <emmintrin.h>
+#else
+#define DRAWGFX_USE_SSE2        0
+#endif
+
+#define ROW_OP_NONE(DEST, PRIORITY, SOURCE, COUNT, XDIR, USAGE)                                 ((void)(USAGE), false)
+
+#define ROW_OP_REBASE_OPAQUE(DEST, PRIORITY, SOURCE, COUNT, XDIR, USAGE)                        \
+	drawgfx_row<false, false>(DEST, PRIORITY, SOURCE, COUNT, XDIR, color, nullptr, 0, 0, USAGE)
+#define ROW_OP_REBASE_OPAQUE_PRIORITY(DEST, PRIORITY, SOURCE, COUNT, XDIR, USAGE)               \
+	drawgfx_row<false, false>(DEST, PRIORITY, SOURCE, COUNT, XDIR, color, nullptr, 0, pmask, USAGE)
+#define ROW_OP_REMAP_OPAQUE_PRIORITY(DEST, PRIORITY, SOURCE, COUNT, XDIR, USAGE)                \
+	drawgfx_row<true, false>(DEST, PRIORITY, SOURCE, COUNT, XDIR, 0, paldata, 0, pmask, USAGE)
+#define ROW_OP_REBASE_TRANSPEN(DEST, PRIORITY, SOURCE, COUNT, XDIR, USAGE)                      \
+	drawgfx_row<false, true>(DEST, PRIORITY, SOURCE, COUNT, XDIR, color, nullptr, trans_pen, 0, USAGE)
+#define ROW_OP_REBASE_TRANSPEN_PRIORITY(DEST, PRIORITY, SOURCE, COUNT, XDIR, USAGE)             \
+	drawgfx_row<false, true>(DEST, PRIORITY, SOURCE, COUNT, XDIR, color, nullptr, trans_pen, pmask, USAGE)
+#define ROW_OP_REMAP_TRANSPEN(DEST, PRIORITY, SOURCE, COUNT, XDIR, USAGE)                       \
+	drawgfx_row<true, true>(DEST, PRIORITY, SOURCE, COUNT, XDIR, 0, paldata, trans_pen, 0, USAGE)
+#define ROW_OP_REMAP_TRANSPEN_PRIORITY(DEST, PRIORITY, SOURCE, COUNT, XDIR, USAGE)              \
+	drawgfx_row<true, true>(DEST, PRIORITY, SOURCE, COUNT, XDIR, 0, paldata, trans_pen, pmask, USAGE)
+
+#if DRAWGFX_USE_SSE2
+
+/* fetch 16 source pixels in destination order */
+static inline __m128i drawgfx_row_fetch(const UINT8 *src, int xdir)
+{
+	if (xdir > 0)
+		return _mm_loadu_si128((const __m128i *)src);
+
+	// reverse the bytes: words first, then the bytes within each word
+	__m128i pix = _mm_loadu_si128((const __m128i *)(src - 15));
+	pix = _mm_shufflelo_epi16(pix, _MM_SHUFFLE(0, 1, 2, 3));
+	pix = _mm_shufflehi_epi16(pix, _MM_SHUFFLE(0, 1, 2, 3));
+	pix = _mm_shuffle_epi32(pix, _MM_SHUFFLE(1, 0, 3, 2));
+	return _mm_or_si128(_mm_slli_epi16(pix, 8), _mm_srli_epi16(pix, 8));
+}
+
+/* per-byte (v >> shift) & 0xff */
+static inline __m128i drawgfx_row_srl8(__m128i v, int shift)
+{
+	return _mm_and_si128(_mm_srli_epi16(v, shift), _mm_set1_epi8((UINT8)(0xff >> shift)));
+}
+
+/* select b where (v & bit) != 0, else a */
+static inline __m128i drawgfx_row_select(__m128i v, UINT8 bit, __m128i a, __m128i b)
+{
+	const __m128i vbit = _mm_set1_epi8(bit);
+	const __m128i sel = _mm_cmpeq_epi8(_mm_and_si128(v, vbit), vbit);
+	return _mm_or_si128(_mm_and_si128(sel, b), _mm_andnot_si128(sel, a));
+}
+
+/* 0xff for each priority byte whose bit in pmask is clear */
+static inline __m128i drawgfx_row_primask(__m128i pri, UINT32 pmask)
+{
+	// pick the pmask byte selected by bits 3-4, then the bit selected by bits 0-2
+	const __m128i lo = drawgfx_row_select(pri, 0x08, _mm_set1_epi8((UINT8)pmask), _mm_set1_epi8((UINT8)(pmask >> 8)));
+	const __m128i hi = drawgfx_row_select(pri, 0x08, _mm_set1_epi8((UINT8)(pmask >> 16)), _mm_set1_epi8((UINT8)(pmask >> 24)));
+	__m128i bits = drawgfx_row_select(pri, 0x10, lo, hi);
+	bits = drawgfx_row_select(pri, 0x04, bits, drawgfx_row_srl8(bits, 4));
+	bits = drawgfx_row_select(pri, 0x02, bits, drawgfx_row_srl8(bits, 2));
+	bits = drawgfx_row_select(pri, 0x01, bits, drawgfx_row_srl8(bits, 1));
+	return _mm_cmpeq_epi8(_mm_and_si128(bits, _mm_set1_epi8(1)), _mm_setzero_si128());
+}
+
+/* blend 16 rebased pixels into the destination where mask is set */
+static inline void drawgfx_row_store(UINT16 *dest, __m128i pix, __m128i mask, UINT32 color)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i vcolor = _mm_set1_epi16((UINT16)color);
+	for (int half = 0; half < 2; half++)
+	{
+		const __m128i val = _mm_add_epi16(half ? _mm_unpackhi_epi8(pix, zero) : _mm_unpacklo_epi8(pix, zero), vcolor);
+		const __m128i m = half ? _mm_unpackhi_epi8(mask, mask) : _mm_unpacklo_epi8(mask, mask);
+		__m128i *d = (__m128i *)(dest + 8 * half);
+		_mm_storeu_si128(d, _mm_or_si128(_mm_and_si128(m, val), _mm_andnot_si128(m, _mm_loadu_si128(d))));
+	}
+}
+
+static inline void drawgfx_row_store(UINT32 *dest, __m128i pix, __m128i mask, UINT32 color)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i vcolor = _mm_set1_epi32(color);
+	for (int quarter = 0; quarter < 4; quarter++)
+	{
+		const __m128i pix16 = (quarter & 2) ? _mm_unpackhi_epi8(pix, zero) : _mm_unpacklo_epi8(pix, zero);
+		const __m128i mask16 = (quarter & 2) ? _mm_unpackhi_epi8(mask, mask) : _mm_unpacklo_epi8(mask, mask);
+		const __m128i val = _mm_add_epi32((quarter & 1) ? _mm_unpackhi_epi16(pix16, zero) : _mm_unpacklo_epi16(pix16, zero), vcolor);
+		const __m128i m = (quarter & 1) ? _mm_unpackhi_epi16(mask16, mask16) : _mm_unpacklo_epi16(mask16, mask16);
+		__m128i *d = (__m128i *)(dest + 4 * quarter);
+		_mm_storeu_si128(d, _mm_or_si128(_mm_and_si128(m, val), _mm_andnot_si128(m, _mm_loadu_si128(d))));
+	}
+}
+
+#endif
+
+/* priority bitmaps other than 8bpp are left to the pixel ops */
+template<typename _PriorityType> struct drawgfx_row_priority { static const bool supported = false; };
+template<> struct drawgfx_row_priority<NO_PRIORITY> { static const bool supported = true; };
+template<> struct drawgfx_row_priority<UINT8> { static const bool supported = true; };
+
+/* pixels [x, count) of a row, one at a time */
+template<bool _Remap, bool _Trans, typename _PixelType, typename _PriorityType>
+static inline void drawgfx_row_pixels(_PixelType *dest, _PriorityType *pri, const UINT8 *src, UINT32 x, UINT32 count, int xdir,
+		UINT32 color, const pen_t *paldata, UINT32 trans_pen, UINT32 pmask)
+{
+	for ( ; x < count; x++)
+	{
+		const UINT32 srcdata = src[xdir * (INT32)x];
+		if (_Trans && srcdata == trans_pen)
+			continue;
+		if (PRIORITY_VALID(_PriorityType))
+		{
+			UINT8 &p = ((UINT8 *)pri)[x];
+			if (((1 << (p & 0x1f)) & pmask) == 0)
+				dest[x] = _Remap ? paldata[srcdata] : (color + srcdata);
+			p = 31;
+		}
+		else
+			dest[x] = _Remap ? paldata[srcdata] : (color + srcdata);
+	}
+}
+
+/* a whole row with SSE2; false if not possible */
+template<bool _Remap, bool _Trans, typename _PixelType, typename _PriorityType>
+static inline bool drawgfx_row_span(_PixelType *dest, _PriorityType *pri, const UINT8 *src, UINT32 count, int xdir,
+		UINT32 color, const pen_t *paldata, UINT32 trans_pen, UINT32 pmask)
+{
+#if DRAWGFX_USE_SSE2
+	const bool use_pri = PRIORITY_VALID(_PriorityType);
+
+	// short rows aren't worth it; pens above 0xff never match
+	if (count < 16 || (_Trans && trans_pen > 0xff))
+		return false;
+
+	const __m128i vtrans = _mm_set1_epi8((UINT8)trans_pen);
+	const __m128i all = _mm_set1_epi8((UINT8)0xff);
+	UINT32 x = 0;
+
+	for ( ; x + 16 <= count; x += 16)
+	{
+		const __m128i pix = drawgfx_row_fetch(src + xdir * (INT32)x, xdir);
+
+		// pixels passing the transparency test
+		__m128i draw = _Trans ? _mm_andnot_si128(_mm_cmpeq_epi8(pix, vtrans), all) : all;
+		if (use_pri)
+		{
+			UINT8 *p = (UINT8 *)pri + x;
+			const __m128i oldpri = _mm_loadu_si128((const __m128i *)p);
+			_mm_storeu_si128((__m128i *)p, _mm_or_si128(_mm_and_si128(draw, _mm_set1_epi8(31)), _mm_andnot_si128(draw, oldpri)));
+			draw = _mm_and_si128(draw, drawgfx_row_primask(oldpri, pmask));
+		}
+
+		const int drawbits = _mm_movemask_epi8(draw);
+		if (drawbits == 0)
+			continue;
+
+		if (!_Remap)
+			drawgfx_row_store(dest + x, pix, draw, color);
+		else
+		{
+			UINT8 pens[16];
+			_mm_storeu_si128((__m128i *)pens, pix);
+			if (drawbits == 0xffff)
+			{
+				for (int i = 0; i < 16; i++)
+					dest[x + i] = paldata[pens[i]];
+			}
+			else
+			{
+				for (int i = 0; i < 16; i++)
+					if (drawbits & (1 << i))
+						dest[x + i] = paldata[pens[i]];
+			}
+		}
+	}
+
+	drawgfx_row_pixels<_Remap, _Trans>(dest, pri, src, x, count, xdir, color, paldata, trans_pen, pmask);
+	return true;
+#else
+	return false;
+#endif
+}
+
+template<bool _Remap, bool _Trans, typename _PixelType, typename _PriorityType>
+static inline bool drawgfx_row(_PixelType *dest, _PriorityType *pri, const UINT8 *src, UINT32 count, int xdir,
+		UINT32 color, const pen_t *paldata, UINT32 trans_pen, UINT32 pmask, UINT32 usage)
+{
+	if (!drawgfx_row_priority<_PriorityType>::supported)
+		return false;
+
+	// use the row's pen usage to skip it or to drop the transparency test
+	if (_Trans && trans_pen < 32)
+	{
+		if ((usage & ~(1 << trans_pen)) == 0)
+			return true;
+		if ((usage & (1 << trans_pen)) == 0)
+		{
+			if (!drawgfx_row_span<_Remap, false>(dest, pri, src, count, xdir, color, paldata, trans_pen, pmask))
+				drawgfx_row_pixels<_Remap, false>(dest, pri, src, 0, count, xdir, color, paldata, trans_pen, pmask);
+			return true;
+		}
+	}
+
+	return drawgfx_row_span<_Remap, _Trans>(dest, pri, src, count, xdir, color, paldata, trans_pen, pmask);
+}
+
+
 /***************************************************************************
     BASIC DRAWGFX CORE
 ***************************************************************************/
@@ -380,10 +607,16 @@ while (0)
         INT32 destx - the top-left X coordinate to render to
         INT32 desty - the top-left Y coordinate to render to
         bitmap_t &priority - the priority bitmap (even if PRIORITY_TYPE is NO_PRIORITY, at least needs a dummy)
+
+    DRAWGFX_ROW_CORE additionally tries the given ROW_OP* on each unzoomed
+    row before falling back to PIXEL_OP.
 */
 
 
 #define DRAWGFX_CORE(PIXEL_TYPE, PIXEL_OP, PRIORITY_TYPE)                               \
+	DRAWGFX_ROW_CORE(PIXEL_TYPE, PIXEL_OP, ROW_OP_NONE, PRIORITY_TYPE)
+
+#define DRAWGFX_ROW_CORE(PIXEL_TYPE, PIXEL_OP, ROW_OP, PRIORITY_TYPE)                   \
 do {                                                                                    \
 	g_profiler.start(PROFILER_DRAWGFX);                                                 \
 	do {                                                                                \
@@ -450,6 +683,8 @@ do {
 																						\
 		/* fetch the source data */                                                     \
 		srcdata = get_data(code);                                      \
+		const UINT32 *rowusage = row_pen_usage(code);                                   \
+		INT32 rowidx = srcy, drowidx = flipy ? -1 : 1;                                  \
 																						\
 		/* compute how many blocks of 4 pixels we have */                           \
 		UINT32 numblocks = (destendx + 1 - destx) / 4;                              \
@@ -468,6 +703,12 @@ do {
 				PIXEL_TYPE *destptr = &dest.pixt<PIXEL_TYPE>(cury, destx);          \
 				const UINT8 *srcptr = srcdata;                                      \
 				srcdata += dy;                                                      \
+				const UINT32 rowuse = rowusage ? rowusage[rowidx] : ~0U;           \
+				rowidx += drowidx;                                                  \
+																					\
+				/* try to render the whole row at once */                           \
+				if (ROW_OP(destptr, priptr, srcptr, numblocks * 4 + leftovers, 1, rowuse)) \
+					continue;                                                       \
 																					\
 				/* iterate over unrolled blocks of 4 */                             \
 				for (curx = 0; curx < numblocks; curx++)                            \
@@ -503,6 +744,12 @@ do {
 				PIXEL_TYPE *destptr = &dest.pixt<PIXEL_TYPE>(cury, destx);          \
 				const UINT8 *srcptr = srcdata;                                      \
 				srcdata += dy;                                                      \
+				const UINT32 rowuse = rowusage ? rowusage[rowidx] : ~0U;           \
+				rowidx += drowidx;                                                  \
+																					\
+				/* try to render the whole row at once */                           \
+				if (ROW_OP(destptr, priptr, srcptr, numblocks * 4 + leftovers, -1, rowuse)) \
+					continue;                                                       \
 																					\
 				/* iterate over unrolled blocks of 4 */                             \
 				for (curx = 0; curx < numblocks; curx++)                            \
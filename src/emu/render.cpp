@@ -316,6 +316,88 @@ void render_primitive_list::append_or_return(render_primitive &prim, bool clippe
 
 
 
+//**************************************************************************
+//  RENDER DIRTY TRACKER
+//**************************************************************************
+
+//-------------------------------------------------
+//  update - compare a primitive list against the
+//  one drawn last time, and find the rows that
+//  have to be drawn again
+//-------------------------------------------------
+
+bool render_dirty_tracker::update(const render_primitive_list &primlist, INT32 width, INT32 height, INT32 &miny, INT32 &maxy)
+{
+	bool same = (!m_entries.empty() && width == m_width && height == m_height);
+	bool lines = false;
+	miny = height;
+	maxy = -1;
+
+	size_t index = 0;
+	for (render_primitive &prim : primlist)
+	{
+		entry cur;
+		cur.type = prim.type;
+		cur.bounds = prim.bounds;
+		cur.color = prim.color;
+		cur.flags = prim.flags;
+		cur.width = prim.width;
+		cur.texcoords = prim.texcoords;
+		cur.base = prim.texture.base;
+		cur.rowpixels = prim.texture.rowpixels;
+		cur.texwidth = prim.texture.width;
+		cur.texheight = prim.texture.height;
+		cur.seqid = prim.texture.seqid;
+		cur.palette = prim.texture.palette;
+		lines |= (prim.type == render_primitive::LINE);
+
+		if (index == m_entries.size())
+		{
+			same = false;
+			m_entries.push_back(cur);
+		}
+		else
+		{
+			entry &prev = m_entries[index];
+			if (same)
+			{
+				// anything that moved or changed shape means starting over
+				if (cur.type != prev.type || memcmp(&cur.bounds, &prev.bounds, sizeof(cur.bounds)) != 0 ||
+					memcmp(&cur.color, &prev.color, sizeof(cur.color)) != 0 || cur.flags != prev.flags || cur.width != prev.width ||
+					memcmp(&cur.texcoords, &prev.texcoords, sizeof(cur.texcoords)) != 0 || (cur.base == nullptr) != (prev.base == nullptr) ||
+					cur.rowpixels != prev.rowpixels || cur.texwidth != prev.texwidth || cur.texheight != prev.texheight || cur.palette != prev.palette)
+					same = false;
+
+				// a texture is unchanged, changed in some rows only, or just changed
+				else if (cur.base != nullptr && (cur.base != prev.base || cur.seqid != prev.seqid))
+				{
+					if (prim.texture.basisseq != 0 && prim.texture.basisseq == prev.seqid)
+						render_texture_dirty_rows(prim, miny, maxy);
+					else
+						same = false;
+				}
+			}
+			prev = cur;
+		}
+		index++;
+	}
+	if (index != m_entries.size())
+		same = false;
+	m_entries.resize(index);
+	m_width = width;
+	m_height = height;
+
+	// lines can only be drawn whole
+	if (lines && miny <= maxy)
+		same = false;
+
+	miny = MAX(miny, 0);
+	maxy = MIN(maxy, height - 1);
+	return same;
+}
+
+
+
 //**************************************************************************
 //  RENDER TEXTURE
 //**************************************************************************
@@ -332,7 +414,11 @@ render_texture::render_texture()
 		m_osddata(~0L),
 		m_scaler(nullptr),
 		m_param(nullptr),
-		m_curseq(0)
+		m_contentseq(0),
+		m_basisseq(0),
+		m_dirtyminy(0),
+		m_dirtymaxy(-1),
+		m_tracked(false)
 {
 	m_sbounds.set(0, -1, 0, -1);
 	memset(m_scaled, 0, sizeof(m_scaled));
@@ -387,7 +473,9 @@ void render_texture::release()
 	m_bitmap = nullptr;
 	m_sbounds.set(0, -1, 0, -1);
 	m_format = TEXFORMAT_ARGB32;
-	m_curseq = 0;
+	m_contentseq = 0;
+	m_basisseq = 0;
+	m_tracked = false;
 }
 
 
@@ -412,6 +500,10 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	m_sbounds = sbounds;
 	m_format = format;
 
+	// new contents, unrelated to anything shown before
+	m_contentseq = m_manager->texture_seqid();
+	m_basisseq = 0;
+
 	// invalidate all scaled versions
 	for (auto & elem : m_scaled)
 	{
@@ -426,6 +518,30 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 }
 
 
+//-------------------------------------------------
+//  set_dirty_rows - note that the bitmap matches
+//  what another texture currently shows, except
+//  in rows miny..maxy of the source bounds; from
+//  then on the texture only changes when told
+//-------------------------------------------------
+
+void render_texture::set_dirty_rows(const render_texture &previous, INT32 miny, INT32 maxy)
+{
+	m_tracked = true;
+
+	// only comparable if both show the same area the same way
+	if (&previous != this && previous.m_bitmap != nullptr && previous.m_format == m_format &&
+		previous.m_sbounds.width() == m_sbounds.width() && previous.m_sbounds.height() == m_sbounds.height())
+	{
+		m_basisseq = previous.m_contentseq;
+		m_dirtyminy = miny;
+		m_dirtymaxy = maxy;
+	}
+	else
+		m_basisseq = 0;
+}
+
+
 //-------------------------------------------------
 //  hq_scale - generic high quality resampling
 //  scaler
@@ -465,7 +581,21 @@ void render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 		texinfo.width = swidth;
 		texinfo.height = sheight;
 		// palette will be set later
-		texinfo.seqid = ++m_curseq;
+
+		// scaled textures and tracked ones only change through set_bitmap; assume
+		// anything else was drawn into since last time
+		if (m_scaler != nullptr || m_tracked)
+		{
+			texinfo.seqid = m_contentseq;
+			texinfo.basisseq = m_basisseq;
+			texinfo.dirtyminy = m_dirtyminy;
+			texinfo.dirtymaxy = m_dirtymaxy;
+		}
+		else
+		{
+			texinfo.seqid = m_manager->texture_seqid();
+			texinfo.basisseq = 0;
+		}
 	}
 	else
 	{
@@ -506,7 +636,7 @@ void render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 
 			// allocate a new bitmap
 			scaled->bitmap = global_alloc(bitmap_argb32(dwidth, dheight));
-			scaled->seqid = ++m_curseq;
+			scaled->seqid = m_manager->texture_seqid();
 
 			// let the scaler do the work
 			(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
@@ -520,6 +650,7 @@ void render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 		texinfo.height = dheight;
 		// palette will be set later
 		texinfo.seqid = scaled->seqid;
+		texinfo.basisseq = 0;
 	}
 }
 
@@ -573,7 +704,8 @@ render_container::render_container(render_manager &manager, screen_device *scree
 		m_manager(manager),
 		m_screen(screen),
 		m_overlaybitmap(nullptr),
-		m_overlaytexture(nullptr)
+		m_overlaytexture(nullptr),
+		m_palette_seqid(0)
 {
 	// make sure it is empty
 	empty();
@@ -799,6 +931,8 @@ render_container::item &render_container::add_generic(UINT8 type, float x0, floa
 
 void render_container::recompute_lookups()
 {
+	m_palette_seqid = m_manager.texture_seqid();
+
 	// recompute the 256 entry lookup table
 	for (int i = 0; i < 0x100; i++)
 	{
@@ -851,6 +985,8 @@ void render_container::update_palette()
 	// iterate over dirty items and update them
 	if (dirty != nullptr)
 	{
+		m_palette_seqid = m_manager.texture_seqid();
+
 		palette_t &palette = m_palclient->palette();
 		const rgb_t *adjusted_palette = palette.entry_list_adjusted();
 
@@ -876,7 +1012,18 @@ void render_container::update_palette()
 			}
 		}
 		else
-			memcpy(&m_bcglookup[mindirty], &adjusted_palette[mindirty], (maxdirty - mindirty + 1) * sizeof(rgb_t));
+		{
+			// copy each run of chunks that have dirty entries, rather than everything from min to max
+			for (UINT32 entry32 = mindirty / 32; entry32 <= maxdirty / 32; entry32++)
+				if (dirty[entry32] != 0)
+				{
+					UINT32 first = MAX(entry32 * 32, mindirty);
+					while (entry32 < maxdirty / 32 && dirty[entry32 + 1] != 0)
+						entry32++;
+					UINT32 last = MIN(entry32 * 32 + 31, maxdirty);
+					memcpy(&m_bcglookup[first], &adjusted_palette[first], (last - first + 1) * sizeof(rgb_t));
+				}
+		}
 	}
 }
 
@@ -1869,6 +2016,13 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					// set the palette
 					prim->texture.palette = curitem.texture()->get_adjusted_palette(container);
 
+					// palette or adjustment changes newer than what the dirty rows are based on change everything
+					if (container.palette_seqid() > prim->texture.basisseq)
+					{
+						prim->texture.seqid = MAX(prim->texture.seqid, container.palette_seqid());
+						prim->texture.basisseq = 0;
+					}
+
 					// determine UV coordinates
 					prim->texcoords = oriented_texcoords[finalorient];
 
@@ -2566,6 +2720,7 @@ render_manager::render_manager(running_machine &machine)
 	: m_machine(machine),
 		m_ui_target(nullptr),
 		m_live_textures(0),
+		m_texture_seqid(0),
 		m_ui_container(global_alloc(render_container(*this)))
 {
 	// register callbacks
@@ -221,6 +221,9 @@ struct render_texinfo
 	UINT32              seqid;              // sequence ID
 	UINT64              osddata;            // aux data to pass to osd
 	const rgb_t *       palette;            // palette for PALETTE16 textures, bcg lookup table for RGB32/YUY16
+	UINT32              basisseq;           // sequence ID of data that differs from this only in dirty rows, or 0
+	INT32               dirtyminy;          // first row that differs from basisseq
+	INT32               dirtymaxy;          // last row that differs from basisseq
 };
 
 
@@ -415,6 +418,46 @@ private:
 };
 
 
+// ======================> render_dirty_tracker
+
+// a render_dirty_tracker remembers the primitives drawn into a target that
+// persists between frames, and works out which of its rows need redrawing
+class render_dirty_tracker
+{
+public:
+	render_dirty_tracker() : m_width(0), m_height(0) { }
+
+	// compare against the previous list; false means redraw everything, otherwise
+	// rows miny..maxy need redrawing (none if miny > maxy)
+	bool update(const render_primitive_list &primlist, INT32 width, INT32 height, INT32 &miny, INT32 &maxy);
+
+	// forget the previous list, e.g. when the target was drawn over
+	void reset() { m_entries.clear(); }
+
+private:
+	// what a primitive looked like the last time it was drawn
+	struct entry
+	{
+		render_primitive::primitive_type type;
+		render_bounds       bounds;
+		render_color        color;
+		UINT32              flags;
+		float               width;
+		render_quad_texuv   texcoords;
+		void *              base;
+		UINT32              rowpixels;
+		UINT32              texwidth;
+		UINT32              texheight;
+		UINT32              seqid;
+		const rgb_t *       palette;
+	};
+
+	std::vector<entry>  m_entries;
+	INT32               m_width;
+	INT32               m_height;
+};
+
+
 // ======================> render_texture
 
 // a render_texture is used to track transformations when building an object list
@@ -444,6 +487,9 @@ public:
 	// configure the texture bitmap
 	void set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, texture_format format);
 
+	// note which rows of the bitmap differ from what another texture shows now
+	void set_dirty_rows(const render_texture &previous, INT32 miny, INT32 maxy);
+
 	// set any necessary aux data
 	void set_osd_data(UINT64 data) { m_osddata = data; }
 
@@ -475,8 +521,14 @@ private:
 	// scaling state (ARGB32 only)
 	texture_scaler_func m_scaler;                   // scaling callback
 	void *              m_param;                    // scaling callback parameter
-	UINT32              m_curseq;                   // current sequence number
 	scaled_texture      m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
+
+	// change tracking
+	UINT32              m_contentseq;               // sequence number of the current bitmap contents
+	UINT32              m_basisseq;                 // contents that differ from ours only in the dirty rows
+	INT32               m_dirtyminy;                // first dirty row, relative to the source bounds
+	INT32               m_dirtymaxy;                // last dirty row, relative to the source bounds
+	bool                m_tracked;                  // owner reports all changes through set_dirty_rows
 };
 
 
@@ -544,6 +596,7 @@ public:
 	UINT8 apply_brightness_contrast_gamma(UINT8 value);
 	float apply_brightness_contrast_gamma_fp(float value);
 	const rgb_t *bcg_lookup_table(int texformat, palette_t *palette = nullptr);
+	UINT32 palette_seqid() const { return m_palette_seqid; }
 
 private:
 	// an item describes a high level primitive that is added to a container
@@ -598,6 +651,7 @@ private:
 	std::unique_ptr<palette_client> m_palclient;       // client to the screen palette
 	std::vector<rgb_t>           m_bcglookup;            // copy of screen palette with bcg adjustment
 	rgb_t                   m_bcglookup256[0x400];  // lookup table for brightness/contrast/gamma
+	UINT32                  m_palette_seqid;        // texture sequence number of the last lookup change
 };
 
 
@@ -1074,6 +1128,9 @@ public:
 	render_texture *texture_alloc(texture_scaler_func scaler = nullptr, void *param = nullptr);
 	void texture_free(render_texture *texture);
 
+	// texture sequence numbers, unique across textures
+	UINT32 texture_seqid() { return ++m_texture_seqid; }
+
 	// fonts
 	render_font *font_alloc(const char *filename = nullptr);
 	void font_free(render_font *font);
@@ -1102,6 +1159,7 @@ private:
 
 	// texture lists
 	UINT32                          m_live_textures;    // number of live textures
+	UINT32                          m_texture_seqid;    // last texture sequence number handed out
 	fixed_allocator<render_texture> m_texture_allocator;// texture allocator
 
 	// containers for the UI and for screens
@@ -498,7 +498,7 @@ private:
 	//  draw_rect - draw a solid rectangle
 	//-------------------------------------------------
 
-	static void draw_rect(const render_primitive &prim, _PixelType *dstdata, INT32 width, INT32 height, UINT32 pitch)
+	static void draw_rect(const render_primitive &prim, _PixelType *dstdata, INT32 width, INT32 height, UINT32 pitch, INT32 miny, INT32 maxy)
 	{
 		render_bounds fpos = prim.bounds;
 		assert(fpos.x0 <= fpos.x1);
@@ -520,6 +520,10 @@ private:
 		if (endy < 0) endy = 0;
 		if (endy >= height) endy = height;
 
+		// stay within the rows being drawn
+		starty = MAX(starty, miny);
+		endy = MIN(endy, maxy + 1);
+
 		// bail if nothing left
 		if (fpos.x0 > fpos.x1 || fpos.y0 > fpos.y1)
 			return;
@@ -1801,7 +1805,7 @@ private:
 	//  drawing routine
 	//-------------------------------------------------
 
-	static void setup_and_draw_textured_quad(const render_primitive &prim, _PixelType *dstdata, INT32 width, INT32 height, UINT32 pitch)
+	static void setup_and_draw_textured_quad(const render_primitive &prim, _PixelType *dstdata, INT32 width, INT32 height, UINT32 pitch, INT32 miny, INT32 maxy)
 	{
 		assert(prim.bounds.x0 <= prim.bounds.x1);
 		assert(prim.bounds.y0 <= prim.bounds.y1);
@@ -1848,6 +1852,15 @@ private:
 			setup.startv -= 0x8000;
 		}
 
+		// stay within the rows being drawn, stepping U/V to the first of them
+		if (setup.starty < miny)
+		{
+			setup.startu += (miny - setup.starty) * setup.dudy;
+			setup.startv += (miny - setup.starty) * setup.dvdy;
+			setup.starty = miny;
+		}
+		setup.endy = MIN(setup.endy, maxy + 1);
+
 		// render based on the texture coordinates
 		switch (prim.flags & (PRIMFLAG_TEXFORMAT_MASK | PRIMFLAG_BLENDMODE_MASK))
 		{
@@ -1908,24 +1921,37 @@ private:
 
 public:
 	static void draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch)
+	{
+		draw_primitives(primlist, dstdata, width, height, pitch, 0, height - 1);
+	}
+
+	// redraw rows miny..maxy only, leaving the rest of the target as it was; lines
+	// are always drawn whole, so only lists without them can be redrawn in part
+	static void draw_primitives(const render_primitive_list &primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, INT32 miny, INT32 maxy)
 	{
 		// loop over the list and render each element
 		for (const render_primitive *prim = primlist.first(); prim != nullptr; prim = prim->next())
-			switch (prim->type)
-			{
-				case render_primitive::LINE:
-					draw_line(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
-					break;
-
-				case render_primitive::QUAD:
-					if (!prim->texture.base)
-						draw_rect(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
-					else
-						setup_and_draw_textured_quad(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
-					break;
-
-				default:
-					throw emu_fatalerror("Unexpected render_primitive type");
-			}
+			draw_primitive(*prim, dstdata, width, height, pitch, miny, maxy);
+	}
+
+	// draw a single primitive within rows miny..maxy
+	static void draw_primitive(const render_primitive &prim, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, INT32 miny, INT32 maxy)
+	{
+		switch (prim.type)
+		{
+			case render_primitive::LINE:
+				draw_line(prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+				break;
+
+			case render_primitive::QUAD:
+				if (!prim.texture.base)
+					draw_rect(prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch, miny, maxy);
+				else
+					setup_and_draw_textured_quad(prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch, miny, maxy);
+				break;
+
+			default:
+				throw emu_fatalerror("Unexpected render_primitive type");
+		}
 	}
 };
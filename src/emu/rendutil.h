@@ -13,6 +13,7 @@
 #include "render.h"
 
 #include <math.h>
+#include <utility>
 
 
 /***************************************************************************
@@ -198,4 +199,44 @@ static inline UINT8 apply_brightness_contrast_gamma(UINT8 src, float brightness,
 }
 
 
+/*-------------------------------------------------
+    render_texture_dirty_rows - extend a row range
+    by the target rows a textured quad draws from
+    its dirty texture rows
+-------------------------------------------------*/
+
+static inline void render_texture_dirty_rows(const render_primitive &prim, INT32 &miny, INT32 &maxy)
+{
+	const render_texinfo &texture = prim.texture;
+	if (texture.dirtyminy > texture.dirtymaxy)
+		return;
+
+	/* the whole quad, with a row either side for rounding */
+	INT32 top = INT32(floorf(prim.bounds.y0)) - 1;
+	INT32 bottom = INT32(ceilf(prim.bounds.y1)) + 1;
+
+	/* if texture rows run down the target, narrow that to the rows that sample the dirty ones */
+	float dvdx = prim.texcoords.tr.v - prim.texcoords.tl.v;
+	float dvdy = prim.texcoords.bl.v - prim.texcoords.tl.v;
+	if (dvdx == 0.0f && dvdy != 0.0f)
+	{
+		/* one extra texel either side for filtering */
+		float v0 = float(texture.dirtyminy - 1) / float(texture.height);
+		float v1 = float(texture.dirtymaxy + 2) / float(texture.height);
+		float y0 = prim.bounds.y0 + (v0 - prim.texcoords.tl.v) / dvdy * (prim.bounds.y1 - prim.bounds.y0);
+		float y1 = prim.bounds.y0 + (v1 - prim.texcoords.tl.v) / dvdy * (prim.bounds.y1 - prim.bounds.y0);
+		if (y0 > y1)
+			std::swap(y0, y1);
+		top = MAX(top, INT32(floorf(y0)) - 1);
+		bottom = MIN(bottom, INT32(ceilf(y1)) + 1);
+	}
+
+	if (top <= bottom)
+	{
+		miny = MIN(miny, top);
+		maxy = MAX(maxy, bottom);
+	}
+}
+
+
 #endif  /* __RENDUTIL_H__ */
@@ -582,7 +582,8 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 		m_scanline0_timer(nullptr),
 		m_scanline_timer(nullptr),
 		m_frame_number(0),
-		m_partial_updates_this_frame(0)
+		m_partial_updates_this_frame(0),
+		m_deferred_queue(nullptr)
 {
 	m_unique_id = m_id_counter;
 	m_id_counter++;
@@ -729,6 +730,21 @@ void screen_device::static_set_screen_vblank(device_t &device, screen_vblank_del
 }
 
 
+//-------------------------------------------------
+//  static_set_screen_deferred - set the callbacks
+//  used to defer drawing; capture records what a
+//  partial update needs and draw renders it at the
+//  end of the frame, possibly on another thread
+//-------------------------------------------------
+
+void screen_device::static_set_screen_deferred(device_t &device, screen_capture_delegate capture, screen_deferred_rgb32_delegate draw)
+{
+	screen_device &screen = downcast<screen_device &>(device);
+	screen.m_screen_capture = capture;
+	screen.m_screen_deferred = draw;
+}
+
+
 //-------------------------------------------------
 //  static_set_palette - set the screen palette
 //  configuration
@@ -783,6 +799,10 @@ void screen_device::device_validity_check(validity_checker &valid) const
 		// sanity check screen formats
 		if (m_screen_update_ind16.isnull() && m_screen_update_rgb32.isnull())
 			osd_printf_error("Missing SCREEN_UPDATE function\n");
+
+		// deferred drawing only comes in RGB32
+		if (!m_screen_capture.isnull() && (m_screen_update_rgb32.isnull() || m_screen_deferred.isnull()))
+			osd_printf_error("Deferred screen updates need an RGB32 SCREEN_UPDATE function\n");
 	}
 
 	// check for svg region
@@ -828,6 +848,12 @@ void screen_device::device_start()
 	m_screen_update_ind16.bind_relative_to(*owner());
 	m_screen_update_rgb32.bind_relative_to(*owner());
 	m_screen_vblank.bind_relative_to(*owner());
+	m_screen_capture.bind_relative_to(*owner());
+	m_screen_deferred.bind_relative_to(*owner());
+
+	// deferred updates are drawn in bands on a work queue
+	if (!m_screen_capture.isnull())
+		m_deferred_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
 
 	// if we have a palette and it's not started, wait for it
 	if (m_palette != nullptr && !m_palette->started())
@@ -935,6 +961,11 @@ void screen_device::device_reset()
 
 void screen_device::device_stop()
 {
+	m_deferred_regions.clear();
+	if (m_deferred_queue != nullptr)
+		osd_work_queue_free(m_deferred_queue);
+	m_deferred_queue = nullptr;
+
 	machine().render().texture_free(m_texture[0]);
 	machine().render().texture_free(m_texture[1]);
 	if (m_burnin.valid())
@@ -949,6 +980,10 @@ void screen_device::device_stop()
 
 void screen_device::device_post_load()
 {
+	// whatever was captured belongs to the state we just replaced; the rows
+	// above the restored beam position keep their old contents until the next
+	// frame, just as they do for screens that draw as they go
+	m_deferred_regions.clear();
 	realloc_screen_bitmaps();
 }
 
@@ -1088,6 +1123,9 @@ void screen_device::reset_origin(int beamy, int beamx)
 
 void screen_device::realloc_screen_bitmaps()
 {
+	// pending regions refer to the current bitmaps
+	update_deferred();
+
 	// doesn't apply for vector games
 	if (m_type == SCREEN_TYPE_VECTOR)
 		return;
@@ -1182,13 +1220,7 @@ bool screen_device::update_partial(int scanline)
 	UINT32 flags;
 	if (m_type != SCREEN_TYPE_SVG)
 	{
-		screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
-		switch (curbitmap.format())
-		{
-			default:
-			case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-			case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
-		}
+		flags = update_region(clip);
 	}
 	else
 	{
@@ -1207,6 +1239,109 @@ bool screen_device::update_partial(int scanline)
 }
 
 
+//-------------------------------------------------
+//  update_region - call the screen update for a
+//  region, or capture it for later drawing when
+//  updates are deferred
+//-------------------------------------------------
+
+UINT32 screen_device::update_region(const rectangle &clip)
+{
+	// deferred: let the driver record its state, draw it later
+	if (!m_screen_capture.isnull())
+	{
+		m_screen_capture(*this, clip, m_deferred_regions.size());
+		m_deferred_regions.push_back(clip);
+		return 0;
+	}
+
+	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
+	switch (curbitmap.format())
+	{
+		default:
+		case BITMAP_FORMAT_IND16:   return m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);
+		case BITMAP_FORMAT_RGB32:   return m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);
+	}
+}
+
+
+//-------------------------------------------------
+//  update_deferred - draw every region captured
+//  since the last call; drivers call this before
+//  changing state their capture doesn't record
+//-------------------------------------------------
+
+#define DEFERRED_BAND_REGIONS   16
+
+void screen_device::update_deferred()
+{
+	int count = m_deferred_regions.size();
+	if (count == 0)
+		return;
+
+	// regions normally move down the screen; split them into bands of whole scanlines,
+	// unless something went back up, in which case they all have to go in order
+	bool ordered = true;
+	for (int region = 1; region < count; region++)
+		if (m_deferred_regions[region].min_y < m_deferred_regions[region - 1].max_y)
+			ordered = false;
+
+	m_deferred_bands.clear();
+	int first = 0;
+	for (int region = 1; region <= count; region++)
+		if (region == count || (ordered && region - first >= DEFERRED_BAND_REGIONS && m_deferred_regions[region].min_y > m_deferred_regions[region - 1].max_y))
+		{
+			m_deferred_bands.push_back(deferred_band(*this, first, region));
+			first = region;
+		}
+
+	g_profiler.start(PROFILER_VIDEO);
+
+	if (m_deferred_queue != nullptr && m_deferred_bands.size() > 1)
+	{
+		osd_work_item_queue_multiple(m_deferred_queue, deferred_band_callback, m_deferred_bands.size(), &m_deferred_bands[0], sizeof(deferred_band), WORK_ITEM_FLAG_AUTO_RELEASE);
+
+		// if the queue times out, draw whatever it hasn't started here; the
+		// regions can't be discarded while a worker is still drawing them
+		if (!osd_work_queue_wait(m_deferred_queue, osd_ticks_per_second() * 100))
+		{
+			for (deferred_band &band : m_deferred_bands)
+				deferred_band_callback(&band, 0);
+			if (!osd_work_queue_wait(m_deferred_queue, osd_ticks_per_second() * 100))
+				throw emu_fatalerror("screen '%s': deferred update stalled", tag());
+		}
+	}
+	else
+	{
+		for (deferred_band &band : m_deferred_bands)
+			deferred_band_callback(&band, 0);
+	}
+
+	g_profiler.stop();
+
+	m_deferred_regions.clear();
+}
+
+
+//-------------------------------------------------
+//  deferred_band_callback - draw one band of
+//  captured regions, in capture order
+//-------------------------------------------------
+
+void *screen_device::deferred_band_callback(void *param, int threadid)
+{
+	deferred_band &band = *(deferred_band *)param;
+	if (band.m_claimed.exchange(true))
+		return nullptr;
+	screen_device &screen = *band.m_screen;
+	bitmap_rgb32 &bitmap = screen.m_bitmap[screen.m_curbitmap].as_rgb32();
+
+	for (int region = band.m_first; region < band.m_last; region++)
+		screen.m_screen_deferred(screen, bitmap, screen.m_deferred_regions[region], region);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  update_now - perform an update from the last
 //  beam position up to the current beam position
@@ -1264,13 +1399,7 @@ void screen_device::update_now()
 			{
 				g_profiler.start(PROFILER_VIDEO);
 
-				screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
-				switch (curbitmap.format())
-				{
-					default:
-					case BITMAP_FORMAT_IND16: m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-					case BITMAP_FORMAT_RGB32: m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
-				}
+				update_region(clip);
 
 				m_partial_updates_this_frame++;
 				g_profiler.stop();
@@ -1303,14 +1432,7 @@ void screen_device::update_now()
 
 		LOG_PARTIAL_UPDATES(("doing scanline partial draw: Y %d X %d-%d\n", clip.max_y, clip.min_x, clip.max_x));
 
-		UINT32 flags;
-		screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
-		switch (curbitmap.format())
-		{
-			default:
-			case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-			case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
-		}
+		UINT32 flags = update_region(clip);
 
 		m_partial_updates_this_frame++;
 		g_profiler.stop();
@@ -1536,6 +1658,9 @@ void screen_device::vblank_end()
 
 bool screen_device::update_quads()
 {
+	// draw whatever is still deferred before the bitmap is handed over
+	update_deferred();
+
 	// only update if live
 	if (machine().render().is_live(*this))
 	{
@@ -1546,6 +1671,14 @@ bool screen_device::update_quads()
 			if (!machine().video().skip_this_frame() && m_changed)
 			{
 				m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
+
+				// tell the renderer which rows differ from what is showing now
+				if (m_curtexture != m_curbitmap)
+				{
+					INT32 miny, maxy;
+					changed_rows(m_bitmap[m_curbitmap], m_bitmap[m_curtexture], miny, maxy);
+					m_texture[m_curbitmap]->set_dirty_rows(*m_texture[m_curtexture], miny, maxy);
+				}
 				m_curtexture = m_curbitmap;
 				m_curbitmap = 1 - m_curbitmap;
 			}
@@ -1566,6 +1699,35 @@ bool screen_device::update_quads()
 }
 
 
+//-------------------------------------------------
+//  changed_rows - find the first and last rows of
+//  the visible area that differ between two
+//  bitmaps, relative to its top
+//-------------------------------------------------
+
+void screen_device::changed_rows(screen_bitmap &bitmap, screen_bitmap &other, INT32 &miny, INT32 &maxy) const
+{
+	bitmap_t &cur = bitmap;
+	bitmap_t &prev = other;
+	size_t bytes = m_visarea.width() * cur.bpp() / 8;
+
+	miny = 0;
+	maxy = -1;
+	INT32 y = m_visarea.min_y;
+	while (y <= m_visarea.max_y && memcmp(cur.raw_pixptr(y, m_visarea.min_x), prev.raw_pixptr(y, m_visarea.min_x), bytes) == 0)
+		y++;
+	if (y > m_visarea.max_y)
+		return;
+	miny = y - m_visarea.min_y;
+
+	// the first changed row stops this one
+	y = m_visarea.max_y;
+	while (memcmp(cur.raw_pixptr(y, m_visarea.min_x), prev.raw_pixptr(y, m_visarea.min_x), bytes) == 0)
+		y--;
+	maxy = y - m_visarea.min_y;
+}
+
+
 //-------------------------------------------------
 //  update_burnin - update the burnin bitmap
 //-------------------------------------------------
@@ -8,6 +8,7 @@
 
 ***************************************************************************/
 
+#include <atomic>
 #include <utility>
 
 #pragma once
@@ -152,6 +153,8 @@ typedef delegate<void (screen_device &, bool)> vblank_state_delegate;
 typedef device_delegate<UINT32 (screen_device &, bitmap_ind16 &, const rectangle &)> screen_update_ind16_delegate;
 typedef device_delegate<UINT32 (screen_device &, bitmap_rgb32 &, const rectangle &)> screen_update_rgb32_delegate;
 typedef device_delegate<void (screen_device &, bool)> screen_vblank_delegate;
+typedef device_delegate<void (screen_device &, const rectangle &, int)> screen_capture_delegate;
+typedef device_delegate<void (screen_device &, bitmap_rgb32 &, const rectangle &, int)> screen_deferred_rgb32_delegate;
 
 
 // ======================> screen_device
@@ -195,6 +198,7 @@ public:
 	static void static_set_screen_update(device_t &device, screen_update_ind16_delegate callback);
 	static void static_set_screen_update(device_t &device, screen_update_rgb32_delegate callback);
 	static void static_set_screen_vblank(device_t &device, screen_vblank_delegate callback);
+	static void static_set_screen_deferred(device_t &device, screen_capture_delegate capture, screen_deferred_rgb32_delegate draw);
 	static void static_set_palette(device_t &device, const char *tag);
 	static void static_set_video_attributes(device_t &device, UINT32 flags);
 	static void static_set_color(device_t &device, rgb_t color);
@@ -233,6 +237,7 @@ public:
 	bool update_partial(int scanline);
 	void update_now();
 	void reset_partial_updates();
+	void update_deferred();
 
 	// additional helpers
 	void register_vblank_callback(vblank_state_delegate vblank_callback);
@@ -267,6 +272,9 @@ private:
 	// internal helpers
 	void set_container(render_container &container) { m_container = &container; }
 	void realloc_screen_bitmaps();
+	UINT32 update_region(const rectangle &clip);
+	void changed_rows(screen_bitmap &bitmap, screen_bitmap &other, INT32 &miny, INT32 &maxy) const;
+	static void *deferred_band_callback(void *param, int threadid);
 	void vblank_begin();
 	void vblank_end();
 	void finalize_burnin();
@@ -282,6 +290,8 @@ private:
 	screen_update_ind16_delegate m_screen_update_ind16; // screen update callback (16-bit palette)
 	screen_update_rgb32_delegate m_screen_update_rgb32; // screen update callback (32-bit RGB)
 	screen_vblank_delegate m_screen_vblank;         // screen vblank callback
+	screen_capture_delegate m_screen_capture;       // deferred update state capture callback
+	screen_deferred_rgb32_delegate m_screen_deferred; // deferred update drawing callback
 	optional_device<palette_device> m_palette;      // our palette
 	UINT32              m_video_attributes;         // flags describing the video system
 	const char *        m_svg_region;               // the region in which the svg data is in
@@ -324,6 +334,21 @@ private:
 	UINT64              m_frame_number;             // the current frame number
 	UINT32              m_partial_updates_this_frame;// partial update counter this frame
 
+	// deferred updates
+	struct deferred_band
+	{
+		deferred_band(screen_device &screen, int first, int last) : m_screen(&screen), m_first(first), m_last(last), m_claimed(false) { }
+		deferred_band(const deferred_band &band) : m_screen(band.m_screen), m_first(band.m_first), m_last(band.m_last), m_claimed(false) { }
+
+		screen_device *             m_screen;
+		int                         m_first;        // first region in the band
+		int                         m_last;         // one past the last region in the band
+		std::atomic<bool>           m_claimed;      // set by whoever draws the band
+	};
+	std::vector<rectangle> m_deferred_regions;      // captured regions waiting to be drawn
+	std::vector<deferred_band> m_deferred_bands;    // bands of regions drawn by one work item each
+	osd_work_queue *    m_deferred_queue;           // work queue for drawing the bands
+
 	// VBLANK callbacks
 	class callback_item
 	{
@@ -448,6 +473,8 @@ typedef device_type_iterator<&device_creator<screen_device>, screen_device> scre
 	screen_device::static_set_screen_update(*device, screen_update_delegate_smart(&_class::_method, #_class "::" #_method, nullptr));
 #define MCFG_SCREEN_UPDATE_DEVICE(_device, _class, _method) \
 	screen_device::static_set_screen_update(*device, screen_update_delegate_smart(&_class::_method, #_class "::" #_method, _device));
+#define MCFG_SCREEN_UPDATE_DEFERRED(_class, _capture, _draw) \
+	screen_device::static_set_screen_deferred(*device, screen_capture_delegate(&_class::_capture, #_class "::" #_capture, nullptr, (_class *)nullptr), screen_deferred_rgb32_delegate(&_class::_draw, #_class "::" #_draw, nullptr, (_class *)nullptr));
 #define MCFG_SCREEN_VBLANK_NONE() \
 	screen_device::static_set_screen_vblank(*device, screen_vblank_delegate());
 #define MCFG_SCREEN_VBLANK_DRIVER(_class, _method) \
@@ -368,9 +368,11 @@ tilemap_t &tilemap_t::init(tilemap_manager &manager, device_gfx_interface &decod
 
 	// reset global states
 	m_enable = true;
+	m_parallel_draw = false;
 	m_attributes = 0;
 	m_all_tiles_dirty = true;
 	m_all_tiles_clean = false;
+	m_all_tiles_recolor = false;
 	m_palette_offset = 0;
 	m_gfx_used = 0;
 	memset(m_gfx_dirtyseq, 0, sizeof(m_gfx_dirtyseq));
@@ -648,6 +650,7 @@ void tilemap_t::mappings_create()
 	m_memory_to_logical.resize(max_memory_index);
 	m_logical_to_memory.resize(max_logical_index);
 	m_tileflags.resize(max_logical_index);
+	m_tilesource.resize(max_logical_index);
 
 	// update the mappings
 	mappings_update();
@@ -701,8 +704,16 @@ inline void tilemap_t::realize_all_dirty_tiles()
 	{
 		memset(&m_tileflags[0], TILE_FLAG_DIRTY, m_tileflags.size());
 		m_all_tiles_dirty = false;
+		m_all_tiles_recolor = false;
 		m_gfx_used = 0;
 	}
+
+	// if only the colors changed, recolor the tiles we already have
+	else if (m_all_tiles_recolor)
+	{
+		recolor_all_tiles();
+		m_all_tiles_recolor = false;
+	}
 }
 
 //-------------------------------------------------
@@ -729,7 +740,17 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	for (int row = 0; row < m_rows; row++)
 		for (int col = 0; col < m_cols; col++, logindex++)
 			if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
-				tile_update(logindex, col, row);
+			{
+				// in parallel mode, only fetch the tile now and render it below
+				if (m_parallel_draw)
+				{
+					tile_fetch(logindex);
+					tile_queue_render(logindex, col, row, 0);
+				}
+				else
+					tile_update(logindex, col, row);
+			}
+	tile_flush_renders();
 
 	// mark it all clean
 	m_all_tiles_clean = true;
@@ -746,34 +767,228 @@ void tilemap_t::tile_update(logical_index logindex, UINT32 col, UINT32 row)
 {
 g_profiler.start(PROFILER_TILEMAP_UPDATE);
 
+	tile_fetch(logindex);
+	tile_render(logindex, col, row);
+
+g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  tile_fetch - call the get info callback for a
+//  tile and remember what it returned
+//-------------------------------------------------
+
+void tilemap_t::tile_fetch(logical_index logindex)
+{
 	// call the get info callback for the associated memory index
 	tilemap_memory_index memindex = m_logical_to_memory[logindex];
 	m_tile_get_info(*this, m_tileinfo, memindex);
 
-	// apply the global tilemap flip to the returned flip flags
-	UINT32 flags = m_tileinfo.flags ^ (m_attributes & 0x03);
+	// remember the source of the tile, applying the global tilemap flip to the flip flags
+	tile_source &source = m_tilesource[logindex];
+	source.pen_data = m_tileinfo.pen_data;
+	source.mask_data = m_tileinfo.mask_data;
+	source.palette_base = m_tileinfo.palette_base;
+	source.category = m_tileinfo.category;
+	source.group = m_tileinfo.group;
+	source.flags = m_tileinfo.flags ^ (m_attributes & 0x03);
+	source.pen_mask = m_tileinfo.pen_mask;
+	source.gfx_data = m_tileinfo.gfxnum != 0xff && m_tileinfo.decoder->gfx(m_tileinfo.gfxnum)->owns_data(m_tileinfo.pen_data);
+
+	// track which gfx have been used for this tilemap
+	if (m_tileinfo.gfxnum != 0xff && (m_gfx_used & (1 << m_tileinfo.gfxnum)) == 0)
+	{
+		m_gfx_used |= 1 << m_tileinfo.gfxnum;
+		m_gfx_dirtyseq[m_tileinfo.gfxnum] = m_tileinfo.decoder->gfx(m_tileinfo.gfxnum)->dirtyseq();
+	}
+}
+
+
+//-------------------------------------------------
+//  tile_render - render a fetched tile into the
+//  pixmap and flagsmap; only touches the tile's
+//  own pixels, so different tiles can be
+//  rendered concurrently
+//-------------------------------------------------
+
+void tilemap_t::tile_render(logical_index logindex, UINT32 col, UINT32 row)
+{
+	const tile_source &source = m_tilesource[logindex];
 
 	// draw the tile, using either direct or transparent
 	UINT32 x0 = m_tilewidth * col;
 	UINT32 y0 = m_tileheight * row;
-	m_tileflags[logindex] = tile_draw(m_tileinfo.pen_data, x0, y0,
-		m_tileinfo.palette_base, m_tileinfo.category, m_tileinfo.group, flags, m_tileinfo.pen_mask);
+	UINT8 tileflags = tile_draw(source.pen_data, x0, y0,
+		source.palette_base, source.category, source.group, source.flags, source.pen_mask);
 
 	// if mask data is specified, apply it
-	if ((flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && m_tileinfo.mask_data != nullptr)
-		m_tileflags[logindex] = tile_apply_bitmask(m_tileinfo.mask_data, x0, y0, m_tileinfo.category, flags);
+	if ((source.flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && source.mask_data != nullptr)
+		tileflags = tile_apply_bitmask(source.mask_data, x0, y0, source.category, source.flags);
 
-	// track which gfx have been used for this tilemap
-	if (m_tileinfo.gfxnum != 0xff && (m_gfx_used & (1 << m_tileinfo.gfxnum)) == 0)
+	m_tileflags[logindex] = tileflags;
+}
+
+
+//-------------------------------------------------
+//  tile_rebase - add a delta to every pixel of a
+//  tile whose palette base alone has changed
+//-------------------------------------------------
+
+void tilemap_t::tile_rebase(UINT32 col, UINT32 row, UINT16 delta)
+{
+	UINT32 x0 = m_tilewidth * col;
+	UINT32 y0 = m_tileheight * row;
+	for (int ty = 0; ty < m_tileheight; ty++)
 	{
-		m_gfx_used |= 1 << m_tileinfo.gfxnum;
-		m_gfx_dirtyseq[m_tileinfo.gfxnum] = m_tileinfo.decoder->gfx(m_tileinfo.gfxnum)->dirtyseq();
+		UINT16 *pixptr = &m_pixmap.pix16(y0 + ty, x0);
+		for (int tx = 0; tx < m_tilewidth; tx++)
+			pixptr[tx] += delta;
 	}
+}
+
+
+//-------------------------------------------------
+//  recolor_all_tiles - refetch every realized
+//  tile after mark_all_palette_dirty; tiles whose
+//  palette base alone changed are rebased in the
+//  pixmap, others are rendered again
+//-------------------------------------------------
+
+void tilemap_t::recolor_all_tiles()
+{
+g_profiler.start(PROFILER_TILEMAP_UPDATE);
+
+	logical_index logindex = 0;
+	for (int row = 0; row < m_rows; row++)
+		for (int col = 0; col < m_cols; col++, logindex++)
+		{
+			// tiles that are dirty anyway will be fully rendered later
+			if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
+				continue;
+
+			const tile_source old = m_tilesource[logindex];
+			tile_fetch(logindex);
+			const tile_source &source = m_tilesource[logindex];
+
+			// anything other than the palette base affects the flags too; render it again,
+			// otherwise just move the pens to the new palette base
+			switch (tile_recolor(old, source))
+			{
+				case RECOLOR_RENDER:
+					tile_queue_render(logindex, col, row, 0);
+					break;
+
+				case RECOLOR_REBASE:
+					tile_queue_render(logindex, col, row, source.palette_base - old.palette_base);
+					break;
+
+				case RECOLOR_NONE:
+					break;
+			}
+		}
+	tile_flush_renders();
 
 g_profiler.stop();
 }
 
 
+//-------------------------------------------------
+//  tile_queue_render - render or rebase a tile
+//  whose source is fetched; in parallel mode the
+//  work is queued until tile_flush_renders,
+//  unless the tile's pen data is not in a gfx
+//  element
+//-------------------------------------------------
+
+void tilemap_t::tile_queue_render(logical_index logindex, UINT32 col, UINT32 row, UINT16 rebase)
+{
+	// a render reads pen_data, which only stays put if it is in a gfx element
+	if (!m_parallel_draw || (rebase == 0 && !m_tilesource[logindex].gfx_data))
+	{
+		if (rebase != 0)
+			tile_rebase(col, row, rebase);
+		else
+			tile_render(logindex, col, row);
+		return;
+	}
+
+	tile_job job;
+	job.logindex = logindex;
+	job.col = col;
+	job.row = row;
+	job.rebase = rebase;
+	m_tilejobs.push_back(job);
+}
+
+
+//-------------------------------------------------
+//  tile_flush_renders - perform all the queued
+//  tile renders, splitting them into ranges of
+//  rows for the work queue if there are enough
+//-------------------------------------------------
+
+void tilemap_t::tile_flush_renders()
+{
+	int jobs = m_tilejobs.size();
+	if (jobs == 0)
+		return;
+
+	// the jobs are queued in row order, so each range covers a band of rows
+	int ranges = MIN(MAX_DRAW_BANDS, jobs / MIN_RENDER_RANGE_TILES);
+	if (ranges > 1)
+	{
+		for (int rangenum = 0; rangenum < ranges; rangenum++)
+		{
+			tile_range &range = m_tileranges[rangenum];
+			range.claimed = false;
+			range.tilemap = this;
+			range.start = jobs * rangenum / ranges;
+			range.end = jobs * (rangenum + 1) / ranges;
+		}
+
+		m_manager->run_work(tile_range_callback, m_tileranges, ranges, sizeof(m_tileranges[0]));
+	}
+	else
+		tile_render_range(0, jobs);
+
+	m_tilejobs.clear();
+}
+
+
+//-------------------------------------------------
+//  tile_range_callback - work queue callback to
+//  render a range of queued tiles
+//-------------------------------------------------
+
+void *tilemap_t::tile_range_callback(void *param, int threadid)
+{
+	tile_range &range = *reinterpret_cast<tile_range *>(param);
+	if (range.claimed.exchange(true))
+		return nullptr;
+	range.tilemap->tile_render_range(range.start, range.end);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  tile_render_range - render the queued tiles
+//  in [start, end)
+//-------------------------------------------------
+
+void tilemap_t::tile_render_range(int start, int end)
+{
+	for (int jobnum = start; jobnum < end; jobnum++)
+	{
+		const tile_job &job = m_tilejobs[jobnum];
+		if (job.rebase != 0)
+			tile_rebase(job.col, job.row, job.rebase);
+		else
+			tile_render(job.logindex, job.col, job.row);
+	}
+}
+
+
 //-------------------------------------------------
 //  tile_draw - draw a single tile to the
 //  tilemap's internal pixmap, using the pen as
@@ -945,9 +1160,63 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	blit_parameters blit;
 	configure_blit_parameters(blit, screen.priority(), cliprect, flags, priority, priority_mask);
 
-	// flush the dirty state to all tiles as appropriate
-	realize_all_dirty_tiles();
+	// if parallel drawing is enabled and worthwhile, split the cliprect into bands
+	int bands = m_parallel_draw ? MIN(MAX_DRAW_BANDS, blit.cliprect.height() / MIN_DRAW_BAND_HEIGHT) : 1;
+	if (bands > 1)
+	{
+		// bring every tile up to date first; the pixmap and flags are only read while drawing
+		pixmap_update();
+
+		// each band draws the whole layer clipped to its own rows
+		for (int bandnum = 0; bandnum < bands; bandnum++)
+		{
+			draw_band &band = m_drawbands[bandnum];
+			band.claimed = false;
+			band.tilemap = this;
+			band.screen = &screen;
+			band.dest = &dest;
+			band.blit = blit;
+			band.blit.cliprect.min_y = cliprect.min_y + cliprect.height() * bandnum / bands;
+			band.blit.cliprect.max_y = cliprect.min_y + cliprect.height() * (bandnum + 1) / bands - 1;
+		}
+
+		m_manager->run_work(draw_band_callback<_BitmapClass>, m_drawbands, bands, sizeof(m_drawbands[0]));
+	}
+	else
+	{
+		// flush the dirty state to all tiles as appropriate
+		realize_all_dirty_tiles();
+		draw_layer(screen, dest, blit);
+	}
+g_profiler.stop();
+}
+
 
+//-------------------------------------------------
+//  draw_band_callback - work queue callback to
+//  draw one band of a tilemap
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void *tilemap_t::draw_band_callback(void *param, int threadid)
+{
+	draw_band &band = *reinterpret_cast<draw_band *>(param);
+	if (band.claimed.exchange(true))
+		return nullptr;
+	band.tilemap->draw_layer(*band.screen, *reinterpret_cast<_BitmapClass *>(band.dest), band.blit);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  draw_layer - draw all the instances of the
+//  tilemap needed to cover blit.cliprect,
+//  applying row and column scroll
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void tilemap_t::draw_layer(screen_device &screen, _BitmapClass &dest, blit_parameters &blit)
+{
 	// flip the tilemap around the center of the visible area
 	rectangle visarea = screen.visible_area();
 	UINT32 width = visarea.min_x + visarea.max_x + 1;
@@ -1038,7 +1307,6 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 			}
 		}
 	}
-g_profiler.stop();
 }
 
 void tilemap_t::draw(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect, UINT32 flags, UINT8 priority, UINT8 priority_mask)
@@ -1486,7 +1754,8 @@ void tilemap_t::draw_debug(screen_device &screen, bitmap_rgb32 &dest, UINT32 scr
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_work_queue(nullptr)
 {
 }
 
@@ -1511,6 +1780,10 @@ tilemap_manager::~tilemap_manager()
 				break;
 			}
 	}
+
+	// free the work queue used for parallel drawing
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
 }
 
 
@@ -1570,6 +1843,67 @@ void tilemap_manager::mark_all_dirty()
 }
 
 
+//-------------------------------------------------
+//  mark_all_palette_dirty - tell all the tilemaps
+//  that only the colors of their tiles changed
+//-------------------------------------------------
+
+void tilemap_manager::mark_all_palette_dirty()
+{
+	for (tilemap_t &tmap : m_tilemap_list)
+		tmap.mark_all_palette_dirty();
+}
+
+
+//-------------------------------------------------
+//  set_parallel_draw_all - enable or disable
+//  parallel drawing for all the tilemaps
+//-------------------------------------------------
+
+void tilemap_manager::set_parallel_draw_all(bool parallel)
+{
+	for (tilemap_t &tmap : m_tilemap_list)
+		tmap.set_parallel_draw(parallel);
+}
+
+
+//-------------------------------------------------
+//  work_queue - return the work queue used for
+//  parallel drawing, allocating it on first use
+//-------------------------------------------------
+
+osd_work_queue *tilemap_manager::work_queue()
+{
+	if (m_work_queue == nullptr)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	return m_work_queue;
+}
+
+
+//-------------------------------------------------
+//  run_work - run a set of bands or ranges on
+//  the work queue; any the queue has not started
+//  by the timeout are run here instead, so the
+//  callbacks must skip items already claimed
+//-------------------------------------------------
+
+void tilemap_manager::run_work(osd_work_callback callback, void *items, int count, int itemsize)
+{
+	osd_work_queue *queue = work_queue();
+	osd_work_item_queue_multiple(queue, callback, count, items, itemsize, WORK_ITEM_FLAG_AUTO_RELEASE);
+	if (osd_work_queue_wait(queue, osd_ticks_per_second() * 100))
+		return;
+
+	UINT8 *item = reinterpret_cast<UINT8 *>(items);
+	for (int itemnum = 0; itemnum < count; itemnum++, item += itemsize)
+		(*callback)(item, 0);
+
+	// whatever is left was started by a worker and is still writing to the caller's data
+	if (!osd_work_queue_wait(queue, osd_ticks_per_second() * 100))
+		throw emu_fatalerror("tilemap_manager: work queue stalled");
+}
+
+
 
 //**************************************************************************
 //  TILEMAP DEVICE
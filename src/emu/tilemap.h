@@ -142,7 +142,13 @@
         any global state that is used by the tile_get_info callback but
         which is not reported via other calls to the tilemap code), you
         should invalidate the entire tilemap. You can do this by calling
-        tilemap_t::mark_all_dirty().
+        tilemap_t::mark_all_dirty(). If the change can only affect the
+        palette_base of the tiles (a palette bank switch, for example),
+        call tilemap_t::mark_all_palette_dirty() instead; the tiles are
+        still fetched again, but those whose palette_base alone changed
+        have their pixmap pens moved rather than being rendered again.
+        If the whole tilemap moves by the same amount,
+        tilemap_t::set_palette_offset() avoids even that.
 
     6. In your VIDEO_UPDATE callback, render the tiles by calling
         tilemap_t::draw() or tilemap_t::draw_roz(). If you need to do
@@ -292,6 +298,22 @@
         a single pen in a group, pass a mask of ~0. The helper function
         tilemap_t::map_pen_to_layer() does this for you.
 
+    * Large tilemaps with row or column scroll can be drawn in parallel
+        by calling tilemap_t::set_parallel_draw() (or
+        tilemap_manager::set_parallel_draw_all()) once they are created.
+        tilemap_t::draw() then brings every dirty tile up to date first
+        and renders horizontal bands of the cliprect on a work queue,
+        waiting for them before returning. Since all dirty tiles are
+        fetched up front, tile_get_info must not depend on the order
+        tiles are drawn in. Bringing the tiles up to date is split the
+        same way: tile_get_info is still called for each tile in turn on
+        the calling thread, but the tiles are rendered into the pixmap
+        in ranges of rows on the work queue. Only tiles whose pen_data
+        points into a gfx element are deferred like this; pen_data
+        anywhere else may be a scratch buffer the next tile_get_info
+        call refills, so those tiles are rendered as soon as they are
+        fetched.
+
 ***************************************************************************/
 
 #pragma once
@@ -303,6 +325,8 @@
 #ifndef __TILEMAP_H__
 #define __TILEMAP_H__
 
+#include <atomic>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -486,6 +510,11 @@ class tilemap_t
 	// maximum index in each array
 	static const int MAX_PEN_TO_FLAGS = 256;
 
+	// limits for splitting a parallel draw into bands
+	static const int MAX_DRAW_BANDS = 8;
+	static const int MIN_DRAW_BAND_HEIGHT = 16;
+	static const int MIN_RENDER_RANGE_TILES = 64;
+
 protected:
 	// tilemap_manager controlls our allocations
 	tilemap_t();
@@ -494,6 +523,36 @@ protected:
 	tilemap_t &init(tilemap_manager &manager, device_gfx_interface &decoder, tilemap_get_info_delegate tile_get_info, tilemap_mapper_delegate mapper, int tilewidth, int tileheight, int cols, int rows);
 
 public:
+	// what the get info callback returned for a tile
+	struct tile_source
+	{
+		const UINT8 *       pen_data;
+		const UINT8 *       mask_data;
+		pen_t               palette_base;
+		UINT8               category;
+		UINT8               group;
+		UINT8               flags;              // with the global flip applied
+		UINT8               pen_mask;
+		bool                gfx_data;           // pen_data is in a gfx element, so a deferred render still finds the tile there
+	};
+
+	// what a realized tile needs once fetched again after mark_all_palette_dirty
+	enum recolor_t
+	{
+		RECOLOR_NONE,
+		RECOLOR_REBASE,                         // only the palette base moved; add the difference to its pixels
+		RECOLOR_RENDER
+	};
+	static recolor_t tile_recolor(const tile_source &old, const tile_source &source)
+	{
+		// pen data outside a gfx element may be a scratch buffer refilled
+		// under the same pointer, so there is no telling whether it changed
+		if (!source.gfx_data || source.pen_data != old.pen_data || source.mask_data != old.mask_data || source.category != old.category ||
+			source.group != old.group || source.flags != old.flags || source.pen_mask != old.pen_mask)
+			return RECOLOR_RENDER;
+		return (source.palette_base != old.palette_base) ? RECOLOR_REBASE : RECOLOR_NONE;
+	}
+
 	// getters
 	running_machine &machine() const;
 	tilemap_device *device() const { return m_device; }
@@ -505,6 +564,7 @@ public:
 	UINT32 width() const { return m_width; }
 	UINT32 height() const { return m_height; }
 	bool enabled() const { return m_enable; }
+	bool parallel_draw() const { return m_parallel_draw; }
 	int palette_offset() const { return m_palette_offset; }
 	int scrolldx() const { return (m_attributes & TILEMAP_FLIPX) ? m_dx_flipped : m_dx; }
 	int scrolldy() const { return (m_attributes & TILEMAP_FLIPY) ? m_dy_flipped : m_dy; }
@@ -517,6 +577,7 @@ public:
 
 	// setters
 	void enable(bool enable = true) { m_enable = enable; }
+	void set_parallel_draw(bool parallel = true) { m_parallel_draw = parallel; }
 	void set_user_data(void *user_data) { m_user_data = user_data; }
 	void set_palette(palette_device &palette) { m_palette = &palette; }
 	void set_palette_offset(UINT32 offset) { m_palette_offset = offset; }
@@ -533,6 +594,7 @@ public:
 	// dirtying
 	void mark_tile_dirty(tilemap_memory_index memindex);
 	void mark_all_dirty() { m_all_tiles_dirty = true; m_all_tiles_clean = false; }
+	void mark_all_palette_dirty() { m_all_tiles_recolor = true; m_all_tiles_clean = false; }
 
 	// pen mapping
 	void map_pens_to_layer(int group, pen_t pen, pen_t mask, UINT8 layermask);
@@ -587,6 +649,34 @@ private:
 		UINT8               alpha;
 	};
 
+	// a tile waiting to be rendered or rebased
+	struct tile_job
+	{
+		logical_index       logindex;
+		UINT32              col;
+		UINT32              row;
+		UINT16              rebase;             // palette delta, or 0 to render
+	};
+
+	// a range of tile jobs for the work queue
+	struct tile_range
+	{
+		std::atomic<bool>   claimed;            // set by whoever renders the range
+		tilemap_t *         tilemap;
+		int                 start;
+		int                 end;
+	};
+
+	// one band of a parallel draw
+	struct draw_band
+	{
+		std::atomic<bool>   claimed;            // set by whoever draws the band
+		tilemap_t *         tilemap;
+		screen_device *     screen;
+		void *              dest;
+		blit_parameters     blit;
+	};
+
 	// inline helpers
 	INT32 effective_rowscroll(int index, UINT32 screen_width);
 	INT32 effective_colscroll(int index, UINT32 screen_height);
@@ -611,10 +701,20 @@ private:
 	// internal drawing
 	void pixmap_update();
 	void tile_update(logical_index logindex, UINT32 col, UINT32 row);
+	void tile_fetch(logical_index logindex);
+	void tile_render(logical_index logindex, UINT32 col, UINT32 row);
+	void tile_rebase(UINT32 col, UINT32 row, UINT16 delta);
+	void recolor_all_tiles();
+	void tile_queue_render(logical_index logindex, UINT32 col, UINT32 row, UINT16 rebase);
+	void tile_flush_renders();
+	void tile_render_range(int start, int end);
+	static void *tile_range_callback(void *param, int threadid);
 	UINT8 tile_draw(const UINT8 *pendata, UINT32 x0, UINT32 y0, UINT32 palette_base, UINT8 category, UINT8 group, UINT8 flags, UINT8 pen_mask);
 	UINT8 tile_apply_bitmask(const UINT8 *maskdata, UINT32 x0, UINT32 y0, UINT8 category, UINT8 flags);
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, UINT32 flags, UINT8 priority, UINT8 priority_mask);
 	template<class _BitmapClass> void draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, UINT32 flags, UINT8 priority, UINT8 priority_mask);
+	template<class _BitmapClass> static void *draw_band_callback(void *param, int threadid);
+	template<class _BitmapClass> void draw_layer(screen_device &screen, _BitmapClass &dest, blit_parameters &blit);
 	template<class _BitmapClass> void draw_roz_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, UINT32 startx, UINT32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, UINT32 flags, UINT8 priority, UINT8 priority_mask);
 	template<class _BitmapClass> void draw_instance(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int xpos, int ypos);
 	template<class _BitmapClass> void draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit, UINT32 startx, UINT32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound);
@@ -649,9 +749,11 @@ private:
 
 	// global tilemap states
 	bool                        m_enable;               // true if we are enabled
+	bool                        m_parallel_draw;        // true to draw in bands on the work queue
 	UINT8                       m_attributes;           // global attributes (flipx/y)
 	bool                        m_all_tiles_dirty;      // true if all tiles are dirty
 	bool                        m_all_tiles_clean;      // true if all tiles are clean
+	bool                        m_all_tiles_recolor;    // true if only the colors of all tiles changed
 	UINT32                      m_palette_offset;       // palette offset
 	UINT32                      m_gfx_used;             // bitmask of gfx items used
 	UINT32                      m_gfx_dirtyseq[MAX_GFX_ELEMENTS]; // dirtyseq values from last check
@@ -672,6 +774,10 @@ private:
 	// transparency mapping
 	bitmap_ind8                 m_flagsmap;             // per-pixel flags
 	std::vector<UINT8>               m_tileflags;            // per-tile flags
+	std::vector<tile_source>         m_tilesource;           // per-tile source from the last fetch
+	std::vector<tile_job>            m_tilejobs;             // tiles queued for rendering in parallel
+	tile_range                  m_tileranges[MAX_DRAW_BANDS]; // ranges of the queued tile renders
+	draw_band                   m_drawbands[MAX_DRAW_BANDS]; // bands of the current parallel draw
 	UINT8                       m_pen_to_flags[MAX_PEN_TO_FLAGS * TILEMAP_NUM_GROUPS]; // mapping of pens to flags
 };
 
@@ -701,16 +807,23 @@ public:
 
 	// global operations on all tilemaps
 	void mark_all_dirty();
+	void mark_all_palette_dirty();
 	void set_flip_all(UINT32 attributes);
+	void set_parallel_draw_all(bool parallel = true);
 
 private:
 	// allocate an instance index
 	int alloc_instance() { return ++m_instance; }
 
+	// work queue for parallel drawing
+	osd_work_queue *work_queue();
+	void run_work(osd_work_callback callback, void *items, int count, int itemsize);
+
 	// internal state
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	osd_work_queue *        m_work_queue;
 };
 
 
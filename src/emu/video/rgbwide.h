@@ -0,0 +1,343 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    rgbwide.h
+
+    Multi-pixel companion to rgbaint_t. Holds RGBAWIDE_PIXELS colors of
+    four 32-bit channels each and provides the rgbaint_t operation set,
+    applied to every pixel at once, so renderers can shade spans in
+    batches. Results match rgbgen.h pixel for pixel; shifts right are
+    logical, as with the SSE implementation.
+
+    Uses AVX2 when the compiler targets it and plain C otherwise.
+
+***************************************************************************/
+
+#ifndef __RGBWIDE__
+#define __RGBWIDE__
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && defined(__AVX2__)
+#define RGBAWIDE_USE_AVX2   1
+#include <immintrin.h>
+#else
+#define RGBAWIDE_USE_AVX2   0
+#endif
+
+/* number of pixels held by an rgbaint_wide_t */
+#define RGBAWIDE_PIXELS     2
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+#if RGBAWIDE_USE_AVX2
+
+class rgbaint_wide_t
+{
+public:
+	inline rgbaint_wide_t() : m_value(_mm256_setzero_si256()) { }
+	inline rgbaint_wide_t(const UINT32 *rgba) { load(rgba); }
+	inline rgbaint_wide_t(__m256i value) { m_value = value; }
+
+	// per pixel access; lanes are b, g, r, a from the bottom as in rgbsse.h
+	inline void set(int pixel, INT32 a, INT32 r, INT32 g, INT32 b)
+	{
+		__m256i mask = _mm256_cmpeq_epi32(_mm256_set_epi32(1, 1, 1, 1, 0, 0, 0, 0), _mm256_set1_epi32(pixel));
+		m_value = _mm256_blendv_epi8(m_value, _mm256_set_epi32(a, r, g, b, a, r, g, b), mask);
+	}
+
+	inline void set(int pixel, UINT32 rgba) { set(pixel, (rgba >> 24) & 0xff, (rgba >> 16) & 0xff, (rgba >> 8) & 0xff, rgba & 0xff); }
+
+	inline INT32 get_a32(int pixel) const { return get_lane(pixel * 4 + 3); }
+	inline INT32 get_r32(int pixel) const { return get_lane(pixel * 4 + 2); }
+	inline INT32 get_g32(int pixel) const { return get_lane(pixel * 4 + 1); }
+	inline INT32 get_b32(int pixel) const { return get_lane(pixel * 4 + 0); }
+
+	// RGBAWIDE_PIXELS packed colors in, clamped packed colors out
+	inline void load(const UINT32 *rgba)
+	{
+		m_value = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)rgba));
+	}
+
+	inline void store_rgba_clamp(UINT32 *rgba) const
+	{
+		__m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(m_value, _mm256_setzero_si256()), _mm256_setzero_si256());
+		rgba[0] = _mm256_extract_epi32(packed, 0);
+		rgba[1] = _mm256_extract_epi32(packed, 4);
+	}
+
+	inline void add(const rgbaint_wide_t& color2) { m_value = _mm256_add_epi32(m_value, color2.m_value); }
+	inline void add_imm(const INT32 imm) { m_value = _mm256_add_epi32(m_value, _mm256_set1_epi32(imm)); }
+	inline void sub(const rgbaint_wide_t& color2) { m_value = _mm256_sub_epi32(m_value, color2.m_value); }
+	inline void sub_imm(const INT32 imm) { m_value = _mm256_sub_epi32(m_value, _mm256_set1_epi32(imm)); }
+	inline void subr(const rgbaint_wide_t& color2) { m_value = _mm256_sub_epi32(color2.m_value, m_value); }
+	inline void subr_imm(const INT32 imm) { m_value = _mm256_sub_epi32(_mm256_set1_epi32(imm), m_value); }
+
+	inline void mul(const rgbaint_wide_t& color) { m_value = _mm256_mullo_epi32(m_value, color.m_value); }
+	inline void mul_imm(const INT32 imm) { m_value = _mm256_mullo_epi32(m_value, _mm256_set1_epi32(imm)); }
+
+	inline void shl(const rgbaint_wide_t& shift) { m_value = _mm256_sllv_epi32(m_value, shift.m_value); }
+	inline void shl_imm(const UINT8 shift) { m_value = _mm256_slli_epi32(m_value, shift); }
+	inline void shr(const rgbaint_wide_t& shift) { m_value = _mm256_srlv_epi32(m_value, shift.m_value); }
+	inline void shr_imm(const UINT8 shift) { m_value = _mm256_srli_epi32(m_value, shift); }
+	inline void sra(const rgbaint_wide_t& shift) { m_value = _mm256_srav_epi32(m_value, shift.m_value); }
+	inline void sra_imm(const UINT8 shift) { m_value = _mm256_srai_epi32(m_value, shift); }
+
+	inline void or_reg(const rgbaint_wide_t& color2) { m_value = _mm256_or_si256(m_value, color2.m_value); }
+	inline void or_imm(const INT32 value) { m_value = _mm256_or_si256(m_value, _mm256_set1_epi32(value)); }
+	inline void and_reg(const rgbaint_wide_t& color) { m_value = _mm256_and_si256(m_value, color.m_value); }
+	inline void andnot_reg(const rgbaint_wide_t& color) { m_value = _mm256_andnot_si256(color.m_value, m_value); }
+	inline void and_imm(const INT32 value) { m_value = _mm256_and_si256(m_value, _mm256_set1_epi32(value)); }
+	inline void xor_reg(const rgbaint_wide_t& color2) { m_value = _mm256_xor_si256(m_value, color2.m_value); }
+	inline void xor_imm(const INT32 value) { m_value = _mm256_xor_si256(m_value, _mm256_set1_epi32(value)); }
+
+	inline void clamp_and_clear(const UINT32 sign)
+	{
+		m_value = _mm256_and_si256(m_value, _mm256_cmpeq_epi32(_mm256_and_si256(m_value, _mm256_set1_epi32(sign)), _mm256_setzero_si256()));
+		clamp_to_uint8();
+	}
+
+	inline void clamp_to_uint8()
+	{
+		m_value = _mm256_min_epi32(_mm256_max_epi32(m_value, _mm256_setzero_si256()), _mm256_set1_epi32(255));
+	}
+
+	inline void sign_extend(const UINT32 compare, const UINT32 sign)
+	{
+		__m256i compare_vec = _mm256_set1_epi32(compare);
+		__m256i compare_mask = _mm256_cmpeq_epi32(_mm256_and_si256(m_value, compare_vec), compare_vec);
+		m_value = _mm256_or_si256(m_value, _mm256_and_si256(_mm256_set1_epi32(sign), compare_mask));
+	}
+
+	inline void min(const INT32 value) { m_value = _mm256_min_epi32(m_value, _mm256_set1_epi32(value)); }
+	inline void max(const INT32 value) { m_value = _mm256_max_epi32(m_value, _mm256_set1_epi32(value)); }
+
+	inline void blend(const rgbaint_wide_t& other, UINT8 factor)
+	{
+		m_value = _mm256_add_epi32(_mm256_mullo_epi32(m_value, _mm256_set1_epi32(factor)), _mm256_mullo_epi32(other.m_value, _mm256_set1_epi32(256 - factor)));
+		m_value = _mm256_srai_epi32(m_value, 8);
+	}
+
+	inline void scale_and_clamp(const rgbaint_wide_t& scale)
+	{
+		mul(scale);
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	inline void scale_imm_and_clamp(const INT32 scale)
+	{
+		mul_imm(scale);
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	inline void scale_add_and_clamp(const rgbaint_wide_t& scale, const rgbaint_wide_t& other)
+	{
+		mul(scale);
+		sra_imm(8);
+		add(other);
+		clamp_to_uint8();
+	}
+
+	inline void scale_imm_add_and_clamp(const INT32 scale, const rgbaint_wide_t& other)
+	{
+		mul_imm(scale);
+		sra_imm(8);
+		add(other);
+		clamp_to_uint8();
+	}
+
+	inline void scale2_add_and_clamp(const rgbaint_wide_t& scale, const rgbaint_wide_t& other, const rgbaint_wide_t& scale2)
+	{
+		m_value = _mm256_add_epi32(_mm256_mullo_epi32(m_value, scale.m_value), _mm256_mullo_epi32(other.m_value, scale2.m_value));
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	inline void cmpeq(const rgbaint_wide_t& value) { m_value = _mm256_cmpeq_epi32(m_value, value.m_value); }
+	inline void cmpeq_imm(const INT32 value) { m_value = _mm256_cmpeq_epi32(m_value, _mm256_set1_epi32(value)); }
+	inline void cmpgt(const rgbaint_wide_t& value) { m_value = _mm256_cmpgt_epi32(m_value, value.m_value); }
+	inline void cmpgt_imm(const INT32 value) { m_value = _mm256_cmpgt_epi32(m_value, _mm256_set1_epi32(value)); }
+	inline void cmplt(const rgbaint_wide_t& value) { m_value = _mm256_cmpgt_epi32(value.m_value, m_value); }
+	inline void cmplt_imm(const INT32 value) { m_value = _mm256_cmpgt_epi32(_mm256_set1_epi32(value), m_value); }
+
+	inline void merge_alpha(const rgbaint_wide_t& alpha)
+	{
+		m_value = _mm256_blend_epi32(m_value, alpha.m_value, 0x88);
+	}
+
+protected:
+	inline INT32 get_lane(int lane) const
+	{
+		INT32 lanes[8];
+		_mm256_storeu_si256((__m256i *)lanes, m_value);
+		return lanes[lane];
+	}
+
+	__m256i m_value;
+};
+
+#else
+
+class rgbaint_wide_t
+{
+public:
+	inline rgbaint_wide_t() { for (int i = 0; i < LANES; i++) m_value[i] = 0; }
+	inline rgbaint_wide_t(const UINT32 *rgba) { load(rgba); }
+
+	// per pixel access; lanes are b, g, r, a from the bottom as in rgbsse.h
+	inline void set(int pixel, INT32 a, INT32 r, INT32 g, INT32 b)
+	{
+		m_value[pixel * 4 + 0] = b;
+		m_value[pixel * 4 + 1] = g;
+		m_value[pixel * 4 + 2] = r;
+		m_value[pixel * 4 + 3] = a;
+	}
+
+	inline void set(int pixel, UINT32 rgba) { set(pixel, (rgba >> 24) & 0xff, (rgba >> 16) & 0xff, (rgba >> 8) & 0xff, rgba & 0xff); }
+
+	inline INT32 get_a32(int pixel) const { return m_value[pixel * 4 + 3]; }
+	inline INT32 get_r32(int pixel) const { return m_value[pixel * 4 + 2]; }
+	inline INT32 get_g32(int pixel) const { return m_value[pixel * 4 + 1]; }
+	inline INT32 get_b32(int pixel) const { return m_value[pixel * 4 + 0]; }
+
+	// RGBAWIDE_PIXELS packed colors in, clamped packed colors out
+	inline void load(const UINT32 *rgba)
+	{
+		for (int pixel = 0; pixel < RGBAWIDE_PIXELS; pixel++)
+			set(pixel, rgba[pixel]);
+	}
+
+	inline void store_rgba_clamp(UINT32 *rgba) const
+	{
+		for (int pixel = 0; pixel < RGBAWIDE_PIXELS; pixel++)
+		{
+			UINT32 color = 0;
+			for (int lane = 3; lane >= 0; lane--)
+			{
+				const INT32 value = m_value[pixel * 4 + lane];
+				color = (color << 8) | ((value < 0) ? 0 : (value > 255) ? 255 : value);
+			}
+			rgba[pixel] = color;
+		}
+	}
+
+	inline void add(const rgbaint_wide_t& color2) { for (int i = 0; i < LANES; i++) m_value[i] += color2.m_value[i]; }
+	inline void add_imm(const INT32 imm) { for (int i = 0; i < LANES; i++) m_value[i] += imm; }
+	inline void sub(const rgbaint_wide_t& color2) { for (int i = 0; i < LANES; i++) m_value[i] -= color2.m_value[i]; }
+	inline void sub_imm(const INT32 imm) { for (int i = 0; i < LANES; i++) m_value[i] -= imm; }
+	inline void subr(const rgbaint_wide_t& color2) { for (int i = 0; i < LANES; i++) m_value[i] = color2.m_value[i] - m_value[i]; }
+	inline void subr_imm(const INT32 imm) { for (int i = 0; i < LANES; i++) m_value[i] = imm - m_value[i]; }
+
+	inline void mul(const rgbaint_wide_t& color) { for (int i = 0; i < LANES; i++) m_value[i] = (UINT32)m_value[i] * (UINT32)color.m_value[i]; }
+	inline void mul_imm(const INT32 imm) { for (int i = 0; i < LANES; i++) m_value[i] = (UINT32)m_value[i] * (UINT32)imm; }
+
+	inline void shl(const rgbaint_wide_t& shift) { for (int i = 0; i < LANES; i++) m_value[i] = ((UINT32)shift.m_value[i] > 31) ? 0 : ((UINT32)m_value[i] << shift.m_value[i]); }
+	inline void shl_imm(const UINT8 shift) { for (int i = 0; i < LANES; i++) m_value[i] = (shift > 31) ? 0 : ((UINT32)m_value[i] << shift); }
+	inline void shr(const rgbaint_wide_t& shift) { for (int i = 0; i < LANES; i++) m_value[i] = ((UINT32)shift.m_value[i] > 31) ? 0 : ((UINT32)m_value[i] >> shift.m_value[i]); }
+	inline void shr_imm(const UINT8 shift) { for (int i = 0; i < LANES; i++) m_value[i] = (shift > 31) ? 0 : ((UINT32)m_value[i] >> shift); }
+	inline void sra(const rgbaint_wide_t& shift) { for (int i = 0; i < LANES; i++) m_value[i] = sar(m_value[i], ((UINT32)shift.m_value[i] > 31) ? 31 : shift.m_value[i]); }
+	inline void sra_imm(const UINT8 shift) { for (int i = 0; i < LANES; i++) m_value[i] = sar(m_value[i], (shift > 31) ? 31 : shift); }
+
+	inline void or_reg(const rgbaint_wide_t& color2) { for (int i = 0; i < LANES; i++) m_value[i] |= color2.m_value[i]; }
+	inline void or_imm(const INT32 value) { for (int i = 0; i < LANES; i++) m_value[i] |= value; }
+	inline void and_reg(const rgbaint_wide_t& color) { for (int i = 0; i < LANES; i++) m_value[i] &= color.m_value[i]; }
+	inline void andnot_reg(const rgbaint_wide_t& color) { for (int i = 0; i < LANES; i++) m_value[i] &= ~color.m_value[i]; }
+	inline void and_imm(const INT32 value) { for (int i = 0; i < LANES; i++) m_value[i] &= value; }
+	inline void xor_reg(const rgbaint_wide_t& color2) { for (int i = 0; i < LANES; i++) m_value[i] ^= color2.m_value[i]; }
+	inline void xor_imm(const INT32 value) { for (int i = 0; i < LANES; i++) m_value[i] ^= value; }
+
+	inline void clamp_and_clear(const UINT32 sign)
+	{
+		for (int i = 0; i < LANES; i++)
+			if (m_value[i] & sign)
+				m_value[i] = 0;
+		clamp_to_uint8();
+	}
+
+	inline void clamp_to_uint8() { for (int i = 0; i < LANES; i++) m_value[i] = (m_value[i] < 0) ? 0 : (m_value[i] > 255) ? 255 : m_value[i]; }
+
+	inline void sign_extend(const UINT32 compare, const UINT32 sign)
+	{
+		for (int i = 0; i < LANES; i++)
+			if ((m_value[i] & compare) == compare)
+				m_value[i] |= sign;
+	}
+
+	inline void min(const INT32 value) { for (int i = 0; i < LANES; i++) m_value[i] = (m_value[i] > value) ? value : m_value[i]; }
+	inline void max(const INT32 value) { for (int i = 0; i < LANES; i++) m_value[i] = (m_value[i] < value) ? value : m_value[i]; }
+
+	inline void blend(const rgbaint_wide_t& other, UINT8 factor)
+	{
+		for (int i = 0; i < LANES; i++)
+			m_value[i] = sar((UINT32)m_value[i] * factor + (UINT32)other.m_value[i] * (256 - factor), 8);
+	}
+
+	inline void scale_and_clamp(const rgbaint_wide_t& scale)
+	{
+		mul(scale);
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	inline void scale_imm_and_clamp(const INT32 scale)
+	{
+		mul_imm(scale);
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	inline void scale_add_and_clamp(const rgbaint_wide_t& scale, const rgbaint_wide_t& other)
+	{
+		mul(scale);
+		sra_imm(8);
+		add(other);
+		clamp_to_uint8();
+	}
+
+	inline void scale_imm_add_and_clamp(const INT32 scale, const rgbaint_wide_t& other)
+	{
+		mul_imm(scale);
+		sra_imm(8);
+		add(other);
+		clamp_to_uint8();
+	}
+
+	inline void scale2_add_and_clamp(const rgbaint_wide_t& scale, const rgbaint_wide_t& other, const rgbaint_wide_t& scale2)
+	{
+		for (int i = 0; i < LANES; i++)
+			m_value[i] = sar((UINT32)m_value[i] * (UINT32)scale.m_value[i] + (UINT32)other.m_value[i] * (UINT32)scale2.m_value[i], 8);
+		clamp_to_uint8();
+	}
+
+	inline void cmpeq(const rgbaint_wide_t& value) { for (int i = 0; i < LANES; i++) m_value[i] = (m_value[i] == value.m_value[i]) ? ~0 : 0; }
+	inline void cmpeq_imm(const INT32 value) { for (int i = 0; i < LANES; i++) m_value[i] = (m_value[i] == value) ? ~0 : 0; }
+	inline void cmpgt(const rgbaint_wide_t& value) { for (int i = 0; i < LANES; i++) m_value[i] = (m_value[i] > value.m_value[i]) ? ~0 : 0; }
+	inline void cmpgt_imm(const INT32 value) { for (int i = 0; i < LANES; i++) m_value[i] = (m_value[i] > value) ? ~0 : 0; }
+	inline void cmplt(const rgbaint_wide_t& value) { for (int i = 0; i < LANES; i++) m_value[i] = (m_value[i] < value.m_value[i]) ? ~0 : 0; }
+	inline void cmplt_imm(const INT32 value) { for (int i = 0; i < LANES; i++) m_value[i] = (m_value[i] < value) ? ~0 : 0; }
+
+	inline void merge_alpha(const rgbaint_wide_t& alpha)
+	{
+		for (int pixel = 0; pixel < RGBAWIDE_PIXELS; pixel++)
+			m_value[pixel * 4 + 3] = alpha.m_value[pixel * 4 + 3];
+	}
+
+protected:
+	static const int LANES = RGBAWIDE_PIXELS * 4;
+
+	// arithmetic shift that doesn't rely on signed right shift behaviour
+	static inline INT32 sar(UINT32 value, int shift)
+	{
+		return (value & 0x80000000) ? ~(~value >> shift) : (value >> shift);
+	}
+
+	INT32 m_value[LANES];
+};
+
+#endif
+
+#endif /* __RGBWIDE__ */
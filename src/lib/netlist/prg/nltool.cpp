@@ -275,6 +275,7 @@ static void static_compile(tool_options_t &opts)
 
 	nt.read_netlist(opts.opt_file(), opts.opt_name());
 
+	pout_strm.writeline(pfmt("/* generated by nltool -c static from {1}, do not edit */")(opts.opt_file()));
 	nt.solver()->create_solver_code(pout_strm);
 
 	nt.stop();
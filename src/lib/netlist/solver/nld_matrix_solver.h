@@ -139,7 +139,7 @@ public:
 
 	virtual void create_solver_code(postream &strm)
 	{
-		strm.writeline(pfmt("/* {1} doesn't support static compile */"));
+		strm.writeline(pfmt("/* {1} doesn't support static compile */")(name()));
 	}
 
 protected:
@@ -53,7 +53,7 @@ private:
 
 	void csc_private(postream &strm);
 
-	using extsolver = void (*)(double * RESTRICT m_A, double * RESTRICT RHS);
+	using extsolver = static_solver_proc_t;
 
 	pstring static_compile_name()
 	{
@@ -66,6 +66,7 @@ private:
 
 	unsigned m_dim;
 	pvector_t<int> m_term_cr[_storage_N];
+	pvector_t<unsigned> m_elim;     /* precomputed elimination targets, see vsetup */
 	mat_cr_t<_storage_N> mat;
 	nl_double m_A[_storage_N * _storage_N];
 
@@ -162,13 +163,45 @@ void matrix_solver_GCR_t<m_N, _storage_N>::vsetup(analog_net_t::list_t &nets)
 	mat.ia[iN] = nz;
 	mat.nz_num = nz;
 
+	/* The sparsity pattern is fixed, so do the symbolic part of the
+	 * elimination once: for every row j eliminated by pivot row i store
+	 * the position of (j,i) followed by the positions in row j matching
+	 * the elements of row i right of the diagonal.
+	 */
+	m_elim.clear();
+	for (unsigned i = 0; i < iN - 1; i++)
+	{
+		const unsigned pi = mat.diag[i] + 1;
+		const unsigned piie = mat.ia[i+1];
+
+		for (auto & j : this->m_terms[i]->m_nzbd)
+		{
+			unsigned pj = mat.ia[j];
+
+			while (mat.ja[pj] < i)
+				pj++;
+			m_elim.push_back(pj++);
+
+			for (unsigned pii = pi; pii < piie; pii++)
+			{
+				while (mat.ja[pj] < mat.ja[pii])
+					pj++;
+				m_elim.push_back(pj++);
+			}
+		}
+	}
+
 	this->log().verbose("Ops: {1}  Occupancy ratio: {2}\n", ops, (double) nz / double (iN * iN));
 
 	// FIXME: Move me
 
-	if (netlist().lib().isLoaded())
+	pstring symname = static_compile_name();
+
+	m_proc = find_static_solver(symname);
+	if (m_proc != nullptr)
+		this->log().verbose("Compiled-in static solver {1} found ...", symname);
+	else if (netlist().lib().isLoaded())
 	{
-		pstring symname = static_compile_name();
 		m_proc = this->netlist().lib().template getsym<extsolver>(symname);
 		if (m_proc != nullptr)
 			this->log().verbose("External static solver {1} found ...", symname);
@@ -227,11 +260,22 @@ template <unsigned m_N, unsigned _storage_N>
 void matrix_solver_GCR_t<m_N, _storage_N>::create_solver_code(postream &strm)
 {
 	//const unsigned iN = N();
+	const pstring name = static_compile_name();
 
-	strm.writeline(pfmt("extern \"C\" void {1}(double * __restrict m_A, double * __restrict RHS)")(static_compile_name()));
+	/* the same output builds nlboost.so or is included twice by
+	 * nld_static_solvers.cpp: once for the code, once for the table entry
+	 */
+	strm.writeline("#if !defined(NL_STATIC_SOLVER_TABLE)");
+	strm.writeline(pfmt("#if !defined(NLS_{1})")(name));
+	strm.writeline(pfmt("#define NLS_{1}")(name));
+	strm.writeline(pfmt("extern \"C\" void {1}(double * __restrict m_A, double * __restrict RHS)")(name));
 	strm.writeline("{");
 	csc_private(strm);
 	strm.writeline("}");
+	strm.writeline("#endif");
+	strm.writeline("#else");
+	strm.writeline(pfmt("\t{ \"{1}\", &{2} },")(name)(name));
+	strm.writeline("#endif");
 }
 
 
@@ -307,34 +351,25 @@ int matrix_solver_GCR_t<m_N, _storage_N>::vsolve_non_dynamic(const bool newton_r
 	}
 	else
 	{
+		const unsigned * RESTRICT pe = m_elim.data();
+
 		for (unsigned i = 0; i < iN - 1; i++)
 		{
 			const auto &nzbd = this->m_terms[i]->m_nzbd;
 
 			if (nzbd.size() > 0)
 			{
-				unsigned pi = mat.diag[i];
-				const nl_double f = 1.0 / m_A[pi++];
+				const unsigned pi = mat.diag[i];
+				const nl_double f = 1.0 / m_A[pi];
 				const unsigned piie = mat.ia[i+1];
 
 				for (auto & j : nzbd)
 				{
-					// proceed to column i
-					//__builtin_prefetch(&m_A[mat.diag[j+1]], 1);
-					unsigned pj = mat.ia[j];
-
-					while (mat.ja[pj] < i)
-						pj++;
-
-					const nl_double f1 = - m_A[pj++] * f;
+					const nl_double f1 = - m_A[*pe++] * f;
 
 					// subtract row i from j */
-					for (unsigned pii = pi; pii<piie; )
-					{
-						while (mat.ja[pj] < mat.ja[pii])
-							pj++;
-						m_A[pj++] += m_A[pii++] * f1;
-					}
+					for (unsigned pii = pi + 1; pii < piie; pii++)
+						m_A[*pe++] += m_A[pii] * f1;
 					RHS[j] += f1 * RHS[i];
 				}
 			}
@@ -51,6 +51,18 @@ struct solver_parameters_t
 
 class matrix_solver_t;
 
+/* solvers compiled into the binary, see nld_static_solvers.cpp */
+
+using static_solver_proc_t = void (*)(double * RESTRICT m_A, double * RESTRICT RHS);
+
+struct static_solver_entry_t
+{
+	const char *m_name;
+	static_solver_proc_t m_proc;
+};
+
+static_solver_proc_t find_static_solver(const pstring &name);
+
 NETLIB_OBJECT(solver)
 {
 	NETLIB_CONSTRUCTOR(solver)
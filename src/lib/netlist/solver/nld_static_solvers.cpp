@@ -0,0 +1,45 @@
+// license:GPL-2.0+
+// copyright-holders:Couriersud
+/*
+ * nld_static_solvers.cpp
+ *
+ * Solvers compiled into the binary.
+ *
+ * matrix_solver_GCR_t can replace its generic elimination loop with fully
+ * unrolled code for its fixed matrix structure. To add the solvers of a
+ * netlist run
+ *
+ *     nltool -c static -f <netlist file> -n <netlist> > solver/static/<netlist>.inc
+ *
+ * and add the file to both include lists below. Each solver is named after
+ * a hash of its elimination code, so an entry is only picked up by a matrix
+ * with exactly the same structure. The same generated file can still be
+ * built into nlboost.so instead (see netlist_t::start).
+ *
+ */
+
+#include "solver/nld_solver.h"
+
+/* solver code */
+
+#include "solver/static/kidniki.inc"
+
+NETLIB_NAMESPACE_DEVICES_START()
+
+static const static_solver_entry_t s_static_solvers[] =
+{
+#define NL_STATIC_SOLVER_TABLE
+#include "solver/static/kidniki.inc"
+#undef NL_STATIC_SOLVER_TABLE
+	{ nullptr, nullptr }
+};
+
+static_solver_proc_t find_static_solver(const pstring &name)
+{
+	for (const static_solver_entry_t *e = s_static_solvers; e->m_name != nullptr; e++)
+		if (name.equals(e->m_name))
+			return e->m_proc;
+	return nullptr;
+}
+
+NETLIB_NAMESPACE_DEVICES_END()
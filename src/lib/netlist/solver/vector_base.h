@@ -13,6 +13,14 @@
 #include <algorithm>
 #include "plib/pconfig.h"
 
+/* SSE2 is always available on x86-64 */
+#if defined(__SSE2__) || defined(_M_X64)
+#define NL_VEC_USE_SSE2 (1)
+#include <emmintrin.h>
+#else
+#define NL_VEC_USE_SSE2 (0)
+#endif
+
 #if 0
 template <unsigned _storage_N>
 struct pvector
@@ -79,6 +87,19 @@ inline void vec_add_mult_scalar (const std::size_t & n, const T * RESTRICT v, co
 		result[i] += scalar * v[i];
 }
 
+/* elementwise, so the results match the scalar version exactly */
+inline void vec_add_mult_scalar (const std::size_t & n, const double * RESTRICT v, const double scalar, double * RESTRICT result)
+{
+	std::size_t i = 0;
+#if (NL_VEC_USE_SSE2)
+	const __m128d s = _mm_set1_pd(scalar);
+	for ( ; i + 2 <= n; i += 2 )
+		_mm_storeu_pd(&result[i], _mm_add_pd(_mm_loadu_pd(&result[i]), _mm_mul_pd(s, _mm_loadu_pd(&v[i]))));
+#endif
+	for ( ; i < n; i++ )
+		result[i] += scalar * v[i];
+}
+
 inline void vec_add_ip(const std::size_t & n, const double * RESTRICT v, double * RESTRICT result)
 {
 	for ( std::size_t i = 0; i < n; i++ )
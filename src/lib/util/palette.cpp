@@ -90,8 +90,9 @@ void palette_client::dirty_state::resize(UINT32 colors)
 	m_dirty.resize(dirty_dwords);
 	memset(&m_dirty[0], 0xff, dirty_dwords*4);
 
-	// mark all entries dirty
-	m_dirty[dirty_dwords - 1] &= (1 << (colors % 32)) - 1;
+	// mark all entries dirty, clearing the bits past the end of a partial last dword
+	if (colors % 32 != 0)
+		m_dirty[dirty_dwords - 1] &= (1 << (colors % 32)) - 1;
 
 	// set min/max
 	m_mindirty = 0;
@@ -548,11 +549,14 @@ void palette_t::normalize_range(UINT32 start, UINT32 end, int lum_min, int lum_m
 
 void palette_t::update_adjusted_color(UINT32 group, UINT32 index)
 {
-	// compute the adjusted value
-	rgb_t adjusted = adjust_palette_entry(m_entry_color[index],
-											m_group_bright[group] + m_brightness,
-											m_group_contrast[group] * m_entry_contrast[index] * m_contrast,
-											m_gamma_map);
+	// compute the adjusted value; without brightness or contrast changes only the gamma map applies,
+	// which is what adjust_palette_entry would compute, minus the float math
+	rgb_t entry = m_entry_color[index];
+	float brightness = m_group_bright[group] + m_brightness;
+	float contrast = m_group_contrast[group] * m_entry_contrast[index] * m_contrast;
+	rgb_t adjusted = (brightness == 0.0f && contrast == 1.0f) ?
+			rgb_t(entry.a(), m_gamma_map[entry.r()], m_gamma_map[entry.g()], m_gamma_map[entry.b()]) :
+			adjust_palette_entry(entry, brightness, contrast, m_gamma_map);
 
 	// if not different, ignore
 	UINT32 finalindex = group * m_numcolors + index;
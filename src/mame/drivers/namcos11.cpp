@@ -590,6 +590,7 @@ static MACHINE_CONFIG_START( coh110, namcos11_state )
 	MCFG_TIMER_DRIVER_ADD_PERIODIC("mcu_adc", namcos11_state, mcu_adc_cb, attotime::from_hz(60))
 
 	MCFG_PSXGPU_ADD( "maincpu", "gpu", CXD8561Q, 0x200000, XTAL_53_693175MHz )
+	MCFG_PSXGPU_THREADED( true )
 
 	MCFG_SPEAKER_STANDARD_STEREO("lspeaker", "rspeaker")
 
@@ -610,6 +611,7 @@ static MACHINE_CONFIG_DERIVED( coh100, coh110 )
 	MCFG_RAM_DEFAULT_SIZE("4M")
 
 	MCFG_PSXGPU_REPLACE( "maincpu", "gpu", CXD8538Q, 0x200000, XTAL_53_693175MHz )
+	MCFG_PSXGPU_THREADED( true )
 MACHINE_CONFIG_END
 
 static MACHINE_CONFIG_DERIVED( tekken, coh100 )
@@ -1162,6 +1162,9 @@ void neogeo_state::set_slot_idx(int slot)
 	if (slot != m_curr_slot)
 	{
 		address_space &space = m_maincpu->space(AS_PROGRAM);
+
+		// finish lines drawn from the old cartridge's graphics
+		m_screen->update_deferred();
 		m_curr_slot = slot;
 		m_bank_base = 0;
 
@@ -1675,6 +1678,9 @@ MACHINE_CONFIG_DERIVED( neogeo_arcade, neogeo_base )
 	MCFG_CPU_MODIFY("maincpu")
 	MCFG_CPU_PROGRAM_MAP(main_map_slot)
 
+	MCFG_SCREEN_MODIFY("screen")
+	MCFG_SCREEN_UPDATE_DEFERRED(neogeo_state, screen_capture_neogeo, screen_draw_neogeo)
+
 	MCFG_WATCHDOG_MODIFY("watchdog")
 	MCFG_WATCHDOG_TIME_INIT(attotime::from_ticks(3244030, NEOGEO_MASTER_CLOCK))
 	MCFG_UPD4990A_ADD("upd4990a", XTAL_32_768kHz, NOOP, NOOP)
@@ -1769,6 +1775,9 @@ static MACHINE_CONFIG_DERIVED_CLASS( aes, neogeo_base, aes_state )
 	MCFG_CPU_MODIFY("maincpu")
 	MCFG_CPU_PROGRAM_MAP(aes_main_map)
 
+	MCFG_SCREEN_MODIFY("screen")
+	MCFG_SCREEN_UPDATE_DEFERRED(neogeo_state, screen_capture_neogeo, screen_draw_neogeo)
+
 	MCFG_NEOGEO_MEMCARD_ADD("memcard")
 
 	MCFG_MACHINE_START_OVERRIDE(aes_state, aes)
@@ -221,6 +221,7 @@ public:
 	void copro_fifoout_push(device_t *device, UINT32 data,UINT32 offset,UINT32 mem_mask);
 
 	void model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &cliprect );
+	void model2_exit();
 };
 
 
@@ -88,6 +88,8 @@ public:
 	DECLARE_CUSTOM_INPUT_MEMBER(kizuna4p_start_r);
 
 	UINT32 screen_update_neogeo(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	void screen_capture_neogeo(screen_device &screen, const rectangle &cliprect, int region);
+	void screen_draw_neogeo(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect, int region);
 
 	DECLARE_WRITE8_MEMBER(io_control_w);
 	DECLARE_WRITE8_MEMBER(system_control_w);
@@ -231,6 +233,10 @@ private:
 	UINT8        m_palette_lookup[32][4];
 	int          m_screen_shadow;
 	int          m_palette_bank;
+
+	// lines captured for deferred drawing
+	std::vector<neosprite_line_state> m_deferred_lines;
+	std::vector<pen_t> m_deferred_bg;
 };
 
 
@@ -1,6 +1,8 @@
 // license:LGPL-2.1+
 // copyright-holders:David Haywood, Angelo Salese, Olivier Galibert, Mariusz Wojcieszek, R. Belmont
 
+#include <atomic>
+
 #include "cdrom.h"
 #include "machine/eepromser.h"
 #include "cpu/m68000/m68000.h"
@@ -232,44 +234,101 @@ public:
 	void stv_vdp1_change_framebuffers( void );
 	void video_update_vdp1( void );
 	void stv_vdp1_process_list( void );
-	void stv_vdp1_set_drawpixel( void );
-
-	void stv_vdp1_draw_normal_sprite(const rectangle &cliprect, int sprite_type);
-	void stv_vdp1_draw_scaled_sprite(const rectangle &cliprect);
-	void stv_vdp1_draw_distorted_sprite(const rectangle &cliprect);
-	void stv_vdp1_draw_poly_line(const rectangle &cliprect);
-	void stv_vdp1_draw_line(const rectangle &cliprect);
-	int x2s(int v);
-	int y2s(int v);
-	void vdp1_fill_quad(const rectangle &cliprect, int patterndata, int xsize, const struct spoint *q);
-	void vdp1_fill_line(const rectangle &cliprect, int patterndata, int xsize, INT32 y, INT32 x1, INT32 x2, INT32 u1, INT32 u2, INT32 v1, INT32 v2);
-	void (saturn_state::*drawpixel)(int x, int y, int patterndata, int offsetcnt);
-	void drawpixel_poly(int x, int y, int patterndata, int offsetcnt);
-	void drawpixel_8bpp_trans(int x, int y, int patterndata, int offsetcnt);
-	void drawpixel_4bpp_notrans(int x, int y, int patterndata, int offsetcnt);
-	void drawpixel_4bpp_trans(int x, int y, int patterndata, int offsetcnt);
-	void drawpixel_generic(int x, int y, int patterndata, int offsetcnt);
-	void vdp1_fill_slope(const rectangle &cliprect, int patterndata, int xsize,
-							INT32 x1, INT32 x2, INT32 sl1, INT32 sl2, INT32 *nx1, INT32 *nx2,
-							INT32 u1, INT32 u2, INT32 slu1, INT32 slu2, INT32 *nu1, INT32 *nu2,
-							INT32 v1, INT32 v2, INT32 slv1, INT32 slv2, INT32 *nv1, INT32 *nv2,
-							INT32 _y1, INT32 y2);
-	void stv_vdp1_setup_shading_for_line(INT32 y, INT32 x1, INT32 x2,
+
+	struct stv_vdp2_sprite_list
+	{
+		int CMDCTRL, CMDLINK, CMDPMOD, CMDCOLR, CMDSRCA, CMDSIZE, CMDGRDA;
+		int CMDXA, CMDYA;
+		int CMDXB, CMDYB;
+		int CMDXC, CMDYC;
+		int CMDXD, CMDYD;
+
+		int ispoly;
+
+	};
+
+	/* Gouraud shading */
+
+	struct _stv_gouraud_shading
+	{
+		/* Gouraud shading table */
+		UINT16  GA;
+		UINT16  GB;
+		UINT16  GC;
+		UINT16  GD;
+	};
+
+	/* a drawing command from the list, with the state it was issued under */
+	struct stv_vdp1_command
+	{
+		stv_vdp2_sprite_list sprite;
+		rectangle       cliprect;
+		int             local_x, local_y;
+	};
+
+	/* per command rasterizer state; one per band of lines when drawing on m_vdp1_queue */
+	struct stv_vdp1_raster
+	{
+		saturn_state *  state;
+		stv_vdp2_sprite_list sprite;
+		void (saturn_state::*drawpixel)(stv_vdp1_raster &rs, int x, int y, int patterndata, int offsetcnt);
+		UINT16          sprite_colorbank;
+		_stv_gouraud_shading gouraud;
+		int             local_x, local_y;
+		INT32           min_y, max_y;   /* lines drawn to, and the gouraud scanlines kept for them */
+	};
+
+	osd_work_queue *m_vdp1_queue;
+	std::vector<stv_vdp1_command> m_vdp1_draw_list;
+
+	/* a band of lines queued on m_vdp1_queue, drawn by whichever of a worker or a timed out wait claims it first */
+	struct stv_vdp1_band
+	{
+		stv_vdp1_band() : claimed(false) { }
+		stv_vdp1_band(const stv_vdp1_band &band) : rs(band.rs), claimed(false) { }
+
+		stv_vdp1_raster rs;
+		std::atomic<bool> claimed;
+	};
+	std::vector<stv_vdp1_band> m_vdp1_bands;
+
+	void stv_vdp1_queue_command(const stv_vdp2_sprite_list &sprite, const rectangle &cliprect);
+	void stv_vdp1_draw_list( void );
+	void stv_vdp1_draw_commands(stv_vdp1_raster &rs);
+	void stv_vdp1_draw_command(stv_vdp1_raster &rs, const stv_vdp1_command &cmd);
+	static void *stv_vdp1_draw_band(void *param, int threadid);
+	void stv_vdp1_set_drawpixel(stv_vdp1_raster &rs);
+
+	void stv_vdp1_draw_normal_sprite(stv_vdp1_raster &rs, const rectangle &cliprect, int sprite_type);
+	void stv_vdp1_draw_scaled_sprite(stv_vdp1_raster &rs, const rectangle &cliprect);
+	void stv_vdp1_draw_distorted_sprite(stv_vdp1_raster &rs, const rectangle &cliprect);
+	void stv_vdp1_draw_poly_line(stv_vdp1_raster &rs, const rectangle &cliprect);
+	void stv_vdp1_draw_line(stv_vdp1_raster &rs, const rectangle &cliprect);
+	int x2s(const stv_vdp1_raster &rs, int v);
+	int y2s(const stv_vdp1_raster &rs, int v);
+	void vdp1_fill_quad(stv_vdp1_raster &rs, const rectangle &cliprect, int patterndata, int xsize, const struct spoint *q);
+	void drawpixel_poly(stv_vdp1_raster &rs, int x, int y, int patterndata, int offsetcnt);
+	void drawpixel_8bpp_trans(stv_vdp1_raster &rs, int x, int y, int patterndata, int offsetcnt);
+	void drawpixel_4bpp_notrans(stv_vdp1_raster &rs, int x, int y, int patterndata, int offsetcnt);
+	void drawpixel_4bpp_trans(stv_vdp1_raster &rs, int x, int y, int patterndata, int offsetcnt);
+	void drawpixel_generic(stv_vdp1_raster &rs, int x, int y, int patterndata, int offsetcnt);
+	void stv_vdp1_setup_shading_for_line(stv_vdp1_raster &rs, INT32 y, INT32 x1, INT32 x2,
 												INT32 r1, INT32 g1, INT32 b1,
 												INT32 r2, INT32 g2, INT32 b2);
-	void stv_vdp1_setup_shading_for_slope(
+	void stv_vdp1_setup_shading_for_slope(stv_vdp1_raster &rs,
 							INT32 x1, INT32 x2, INT32 sl1, INT32 sl2, INT32 *nx1, INT32 *nx2,
 							INT32 r1, INT32 r2, INT32 slr1, INT32 slr2, INT32 *nr1, INT32 *nr2,
 							INT32 g1, INT32 g2, INT32 slg1, INT32 slg2, INT32 *ng1, INT32 *ng2,
 							INT32 b1, INT32 b2, INT32 slb1, INT32 slb2, INT32 *nb1, INT32 *nb2,
 							INT32 _y1, INT32 y2);
-	UINT16 stv_vdp1_apply_gouraud_shading( int x, int y, UINT16 pix );
-	void stv_vdp1_setup_shading(const struct spoint* q, const rectangle &cliprect);
-	UINT8 stv_read_gouraud_table( void );
-	void stv_clear_gouraud_shading(void);
+	UINT16 stv_vdp1_apply_gouraud_shading(stv_vdp1_raster &rs, int x, int y, UINT16 pix);
+	void stv_vdp1_setup_shading(stv_vdp1_raster &rs, const struct spoint* q, const rectangle &cliprect);
+	UINT8 stv_read_gouraud_table(stv_vdp1_raster &rs);
+	void stv_clear_gouraud_shading(stv_vdp1_raster &rs);
 
 	void stv_clear_framebuffer( int which_framebuffer );
 	void stv_vdp1_state_save_postload( void );
+	void stv_vdp1_exit ( void );
 	int stv_vdp1_start ( void );
 
 	struct stv_vdp1_poly_scanline
@@ -285,37 +344,11 @@ public:
 
 	struct stv_vdp1_poly_scanline_data
 	{
-		INT32   sy, ey;
 		struct  stv_vdp1_poly_scanline scanline[512];
 	};
 
 	std::unique_ptr<struct stv_vdp1_poly_scanline_data> stv_vdp1_shading_data;
 
-	struct stv_vdp2_sprite_list
-	{
-		int CMDCTRL, CMDLINK, CMDPMOD, CMDCOLR, CMDSRCA, CMDSIZE, CMDGRDA;
-		int CMDXA, CMDYA;
-		int CMDXB, CMDYB;
-		int CMDXC, CMDYC;
-		int CMDXD, CMDYD;
-
-		int ispoly;
-
-	} stv2_current_sprite;
-
-	/* Gouraud shading */
-
-	struct _stv_gouraud_shading
-	{
-		/* Gouraud shading table */
-		UINT16  GA;
-		UINT16  GB;
-		UINT16  GC;
-		UINT16  GD;
-	} stv_gouraud_shading;
-
-	UINT16 m_sprite_colorbank;
-
 	/* VDP1 Framebuffer handling */
 	int      stv_sprite_priorities_used[8];
 	int      stv_sprite_priorities_usage_valid;
@@ -470,6 +503,38 @@ public:
 
 	} stv_current_rotation_parameter_table;
 
+	/* rotation screen copy, split into bands of lines for m_vdp2_roz_queue */
+	struct stv_vdp2_roz_copy
+	{
+		bitmap_rgb32 *  bitmap;
+		bitmap_rgb32 *  roz_bitmap;
+		INT32   dx, dy, yp;
+		INT8    use_coeff_table, coeff_table_mode, coeff_table_size;
+		UINT8   vcnt_shift, hcnt_shift;
+		UINT32  *coeff_table_base, coeff_table_offset;
+		INT32   clipxmask, clipymask;
+		int     planerenderedsizex, planerenderedsizey;
+	};
+
+	/* a band of lines queued on m_vdp2_roz_queue, copied by whichever of a worker or a timed out wait claims it first */
+	struct stv_vdp2_roz_band
+	{
+		stv_vdp2_roz_band() : claimed(false) { }
+		stv_vdp2_roz_band(const stv_vdp2_roz_band &band) : state(band.state), clip(band.clip), kx(band.kx), ky(band.ky), xp(band.xp), claimed(false) { }
+
+		saturn_state *  state;
+		rectangle       clip;
+		INT32           kx, ky, xp;     /* coefficient state carried into the first line */
+		std::atomic<bool> claimed;
+	};
+
+	osd_work_queue *m_vdp2_roz_queue;
+	stv_vdp2_roz_copy m_vdp2_roz_copy;
+	std::vector<stv_vdp2_roz_band> m_vdp2_roz_bands;
+
+	void stv_vdp2_copy_roz_rows(const rectangle &cliprect, INT32 kx, INT32 ky, INT32 xp);
+	static void *stv_vdp2_copy_roz_band(void *param, int threadid);
+
 	struct _stv_vdp2_layer_data_placement
 	{
 		UINT32  map_offset_min;
@@ -187,7 +187,7 @@ WRITE8_MEMBER(_1942_state::c1942_palette_bank_w)
 	if (m_palette_bank != data)
 	{
 		m_palette_bank = data & 3;
-		m_bg_tilemap->mark_all_dirty();
+		m_bg_tilemap->mark_all_palette_dirty();
 	}
 }
 
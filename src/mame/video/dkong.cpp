@@ -505,7 +505,7 @@ WRITE8_MEMBER(dkong_state::dkong_palettebank_w)
 	if (m_palette_bank != newbank)
 	{
 		m_palette_bank = newbank;
-		m_bg_tilemap->mark_all_dirty();
+		m_bg_tilemap->mark_all_palette_dirty();
 	}
 }
 
@@ -280,6 +280,10 @@ VIDEO_START_MEMBER(m92_state,m92)
 		layer->tmap->set_transmask(2, 0x0001, (laynum == 2) ? 0xfffe : 0xffff);
 		layer->wide_tmap->set_transmask(2, 0x0001, (laynum == 2) ? 0xfffe : 0xffff);
 
+		/* the playfields are drawn with line scroll most of the time, split them across the work queue */
+		layer->tmap->set_parallel_draw();
+		layer->wide_tmap->set_parallel_draw();
+
 		save_item(NAME(layer->vram_base), laynum);
 		save_item(NAME(layer->control), laynum);
 	}
@@ -52,9 +52,10 @@
             ....
             FFFF        triangle33->triangle11->triangle9
 
-    As we add polygons to the array, we also keep track of the minimum and maximum z-value indexes seen this frame.
-    When it's time to render, we start and the max z-value seen, and iterate through the array going down to the minimum
-    z-value seen, clipping and rendering the linked polygons as we go.
+    Polygons are rendered from the highest z-value index down to the lowest, and in submission order within the same
+    index. The polygons of a frame are only collected as they come in; at the end of the frame they are z-clipped,
+    projected and sorted in runs on worker threads, and the sorted runs are merged with ties going to the earlier run,
+    which gives the same order as inserting them into the linked lists above one at a time.
     Unfortunately, it seems there's something not quite right, as there are some visible Z-Sort problems in various games.
     Perhaps the linked list of polygons need to be presorted by a unknown factor before rendering.
 
@@ -91,8 +92,18 @@
 #include "video/segaic24.h"
 #include "includes/model2.h"
 
+#include <atomic>
+
 #define MODEL2_VIDEO_DEBUG 0
 
+/* use SSE2 on 64-bit implementations, where it can be assumed */
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)
+#define MODEL2_USE_SSE2 ( 1 )
+#include <emmintrin.h>
+#else
+#define MODEL2_USE_SSE2 ( 0 )
+#endif
+
 
 #define pz      p[0]
 #define pu      p[1]
@@ -244,6 +255,30 @@ static INT32 clip_polygon(poly_vertex *v, INT32 num_vertices, plane *cp, poly_ve
  *******************************************/
 
 #define MAX_TRIANGLES       32768
+#define MAX_POLYGONS        MAX_TRIANGLES
+#define POLYGON_CHUNK       512         /* polygons per geometry work item */
+
+/* a polygon that passed culling, waiting to be z-clipped, projected and z-sorted at the end of the frame */
+struct m2_polygon
+{
+	poly_vertex         v[5];               /* vertices, up to 5 once clipped */
+	UINT8               num_vertices;       /* vertex count, 0 if clipped away */
+	UINT16              z;                  /* Z-Sort value */
+	float               zvalue;             /* z value, with the ZSort mode added */
+	UINT16              texheader[4];
+	UINT8               luma;
+	INT16               viewport[4];
+	INT16               center[2];
+};
+
+/* a run of polygons clipped and sorted by one work item */
+struct m2_geometry_chunk
+{
+	raster_state *      raster;
+	UINT32              start;              /* first polygon */
+	UINT32              count;              /* number of polygons */
+	std::atomic<bool>   claimed;            /* set by whichever thread processes it */
+};
 
 struct raster_state
 {
@@ -259,11 +294,13 @@ struct raster_state
 	UINT32              cur_command;        /* Current command */
 	UINT32              command_buffer[32]; /* Command buffer */
 	UINT32              command_index;      /* Command buffer index */
-	triangle            tri_list[MAX_TRIANGLES];            /* Triangle list */
+	triangle            tri_list[MAX_TRIANGLES];            /* Triangle list, in rendering order */
 	UINT32              tri_list_index;     /* Triangle list index */
-	triangle *          tri_sorted_list[0x10000];   /* Sorted Triangle list */
-	UINT16              min_z;              /* Minimum sortable Z value */
-	UINT16              max_z;              /* Maximum sortable Z value */
+	m2_polygon          poly_list[MAX_POLYGONS];            /* Polygon list, in submission order */
+	UINT32              poly_list_index;    /* Polygon list index */
+	UINT32              poly_sorted_list[MAX_POLYGONS];     /* Polygon indices, sorted by descending Z */
+	m2_geometry_chunk   chunks[MAX_POLYGONS / POLYGON_CHUNK];   /* Geometry work items */
+	osd_work_queue *    queue;              /* Geometry work queue */
 	UINT16          texture_ram[0x10000];       /* Texture RAM pointer */
 	UINT8               log_ram[0x40000];           /* Log RAM pointer */
 };
@@ -302,6 +339,36 @@ void model2_3d_set_zclip( running_machine &machine, UINT8 clip )
  *
  *******************************************/
 
+/* add a polygon that passed culling to this frame's list; clipping and sorting wait for the frame end */
+static void model2_3d_queue_polygon( raster_state *raster, const poly_vertex *v, UINT8 num_vertices, float zvalue, const UINT16 *texheader, UINT8 luma )
+{
+	m2_polygon *poly;
+
+	if ( raster->poly_list_index >= MAX_POLYGONS )
+	{
+		fatalerror( "SEGA 3D: Max triangle limit exceeded\n" );
+	}
+
+	poly = &raster->poly_list[raster->poly_list_index++];
+
+	memcpy( poly->v, v, num_vertices * sizeof( poly_vertex ) );
+	poly->num_vertices = num_vertices;
+
+	/* adjust the object z-sort value, the conversion happens with the clipping */
+	poly->zvalue = zvalue + raster->z_adjust;
+
+	/* copy the object information */
+	memcpy( poly->texheader, texheader, sizeof( poly->texheader ) );
+	poly->luma = luma;
+
+	/* set the viewport */
+	memcpy( poly->viewport, raster->viewport, sizeof( poly->viewport ) );
+
+	/* set the center */
+	poly->center[0] = raster->center[raster->center_sel][0];
+	poly->center[1] = raster->center[raster->center_sel][1];
+}
+
 static void model2_3d_process_quad( raster_state *raster, UINT32 attr )
 {
 	quad_m2     object;
@@ -428,89 +495,7 @@ static void model2_3d_process_quad( raster_state *raster, UINT32 attr )
 	}
 
 	if ( cull == 0 )
-	{
-		INT32       clipped_verts;
-		poly_vertex verts[10];
-		plane       clip_plane;
-
-		clip_plane.normal.x = 0;
-		clip_plane.normal.y = 0;
-		clip_plane.normal.pz = 1;
-		clip_plane.distance = 0;
-
-		/* do near z clipping */
-		clipped_verts = clip_polygon( object.v, 4, &clip_plane, verts);
-
-		if ( clipped_verts > 2 )
-		{
-			triangle *ztri;
-
-			/* adjust and set the object z-sort value */
-			object.z = float_to_zval( zvalue + raster->z_adjust );
-
-			/* get our list read to add the triangles */
-			ztri = raster->tri_sorted_list[object.z];
-
-			if ( ztri != nullptr )
-			{
-				while( ztri->next != nullptr )
-					ztri = (triangle *)ztri->next;
-			}
-
-			/* go through the clipped vertex list, adding triangles */
-			for( i = 2; i < clipped_verts; i++ )
-			{
-				triangle    *tri;
-
-				tri = &raster->tri_list[raster->tri_list_index++];
-
-				if ( raster->tri_list_index >= MAX_TRIANGLES )
-				{
-					fatalerror( "SEGA 3D: Max triangle limit exceeded\n" );
-				}
-
-				/* copy the object information */
-				tri->z = object.z;
-				tri->texheader[0] = object.texheader[0];
-				tri->texheader[1] = object.texheader[1];
-				tri->texheader[2] = object.texheader[2];
-				tri->texheader[3] = object.texheader[3];
-				tri->luma = object.luma;
-
-				/* set the viewport */
-				tri->viewport[0] = raster->viewport[0];
-				tri->viewport[1] = raster->viewport[1];
-				tri->viewport[2] = raster->viewport[2];
-				tri->viewport[3] = raster->viewport[3];
-
-				/* set the center */
-				tri->center[0] = raster->center[raster->center_sel][0];
-				tri->center[1] = raster->center[raster->center_sel][1];
-
-				memcpy( &tri->v[0], &verts[0], sizeof( poly_vertex ) );
-				memcpy( &tri->v[1], &verts[i-1], sizeof( poly_vertex ) );
-				memcpy( &tri->v[2], &verts[i], sizeof( poly_vertex ) );
-
-				/* add to our sorted list */
-				tri->next = nullptr;
-
-				if ( ztri == nullptr )
-				{
-					raster->tri_sorted_list[object.z] = tri;
-				}
-				else
-				{
-					ztri->next = tri;
-				}
-
-				ztri = tri;
-			}
-
-			/* keep around the min and max z values for this frame */
-			if ( object.z < raster->min_z ) raster->min_z = object.z;
-			if ( object.z > raster->max_z ) raster->max_z = object.z;
-		}
-	}
+		model2_3d_queue_polygon( raster, object.v, 4, zvalue, object.texheader, object.luma );
 
 	/* update linking */
 	switch( ((attr >> 8) & 3) )
@@ -663,91 +648,9 @@ static void model2_3d_process_triangle( raster_state *raster, UINT32 attr )
 		raster->triangle_z = zvalue;
 	}
 
-	/* if we're not culling, do z-clip and add to out triangle list */
+	/* if we're not culling, add to our polygon list */
 	if ( cull == 0 )
-	{
-		INT32       clipped_verts;
-		poly_vertex verts[10];
-		plane       clip_plane;
-
-		clip_plane.normal.x = 0;
-		clip_plane.normal.y = 0;
-		clip_plane.normal.pz = 1;
-		clip_plane.distance = 0;
-
-		/* do near z clipping */
-		clipped_verts = clip_polygon( object.v, 3, &clip_plane, verts);
-
-		if ( clipped_verts > 2 )
-		{
-			triangle *ztri;
-
-			/* adjust and set the object z-sort value */
-			object.z = float_to_zval( zvalue + raster->z_adjust );
-
-			/* get our list read to add the triangles */
-			ztri = raster->tri_sorted_list[object.z];
-
-			if ( ztri != nullptr )
-			{
-				while( ztri->next != nullptr )
-					ztri = (triangle *)ztri->next;
-			}
-
-			/* go through the clipped vertex list, adding triangles */
-			for( i = 2; i < clipped_verts; i++ )
-			{
-				triangle    *tri;
-
-				tri = &raster->tri_list[raster->tri_list_index++];
-
-				if ( raster->tri_list_index >= MAX_TRIANGLES )
-				{
-					fatalerror( "SEGA 3D: Max triangle limit exceeded\n" );
-				}
-
-				/* copy the object information */
-				tri->z = object.z;
-				tri->texheader[0] = object.texheader[0];
-				tri->texheader[1] = object.texheader[1];
-				tri->texheader[2] = object.texheader[2];
-				tri->texheader[3] = object.texheader[3];
-				tri->luma = object.luma;
-
-				/* set the viewport */
-				tri->viewport[0] = raster->viewport[0];
-				tri->viewport[1] = raster->viewport[1];
-				tri->viewport[2] = raster->viewport[2];
-				tri->viewport[3] = raster->viewport[3];
-
-				/* set the center */
-				tri->center[0] = raster->center[raster->center_sel][0];
-				tri->center[1] = raster->center[raster->center_sel][1];
-
-				memcpy( &tri->v[0], &verts[0], sizeof( poly_vertex ) );
-				memcpy( &tri->v[1], &verts[i-1], sizeof( poly_vertex ) );
-				memcpy( &tri->v[2], &verts[i], sizeof( poly_vertex ) );
-
-				/* add to our sorted list */
-				tri->next = nullptr;
-
-				if ( ztri == nullptr )
-				{
-					raster->tri_sorted_list[object.z] = tri;
-				}
-				else
-				{
-					ztri->next = tri;
-				}
-
-				ztri = tri;
-			}
-
-			/* keep around the min and max z values for this frame */
-			if ( object.z < raster->min_z ) raster->min_z = object.z;
-			if ( object.z > raster->max_z ) raster->max_z = object.z;
-		}
-	}
+		model2_3d_queue_polygon( raster, object.v, 3, zvalue, object.texheader, object.luma );
 
 	/* update linking */
 	switch( ((attr >> 8) & 3) )
@@ -871,39 +774,183 @@ void model2_renderer::model2_3d_render(triangle *tri, const rectangle &cliprect)
     (8,90)                          (504,90)
 */
 
-/* 3D Rasterizer projection: projects a triangle into screen coordinates */
-static void model2_3d_project( triangle *tri )
+/* 3D Rasterizer projection: projects vertices into screen coordinates */
+static inline void model2_3d_project( poly_vertex *v, INT32 count, const INT16 *center )
 {
-	UINT16  i;
+	const float cx = -8 + center[0];
+	const float cy = (384 - center[1]) + 90;
+	INT32 i = 0;
+
+#if MODEL2_USE_SSE2
+	/* four vertices at a time; the divides round exactly like the scalar ones */
+	const __m128 one = _mm_set1_ps(1.0f);
+	for( ; i + 4 <= count; i += 4 )
+	{
+		float px[4], py[4];
+		__m128 w = _mm_add_ps(one, _mm_setr_ps(v[i].pz, v[i+1].pz, v[i+2].pz, v[i+3].pz));
+		__m128 x = _mm_div_ps(_mm_setr_ps(v[i].x, v[i+1].x, v[i+2].x, v[i+3].x), w);
+		__m128 y = _mm_div_ps(_mm_setr_ps(v[i].y, v[i+1].y, v[i+2].y, v[i+3].y), w);
 
-	for( i = 0; i < 3; i++ )
+		_mm_storeu_ps(px, _mm_add_ps(_mm_set1_ps(cx), x));
+		_mm_storeu_ps(py, _mm_sub_ps(_mm_set1_ps(cy), y));
+
+		for( INT32 j = 0; j < 4; j++ )
+		{
+			v[i+j].x = px[j];
+			v[i+j].y = py[j];
+		}
+	}
+#endif
+
+	for( ; i < count; i++ )
 	{
-		/* project the vertices */
-		tri->v[i].x = -8 + tri->center[0] + (tri->v[i].x / (1.0f+tri->v[i].pz));
-		tri->v[i].y = ((384 - tri->center[1])+90) - (tri->v[i].y / (1.0f+tri->v[i].pz));
+		v[i].x = cx + (v[i].x / (1.0f+v[i].pz));
+		v[i].y = cy - (v[i].y / (1.0f+v[i].pz));
 	}
 }
 
+/* 3D Rasterizer geometry: z-clips and projects a run of polygons, then sorts the run by descending Z */
+static void *model2_3d_process_chunk( void *param, int threadid )
+{
+	m2_geometry_chunk *chunk = (m2_geometry_chunk *)param;
+
+	/* a run left unclaimed after a stalled wait is finished inline, so only process it once */
+	if ( chunk->claimed.exchange( true ) )
+		return nullptr;
+
+	raster_state *raster = chunk->raster;
+	UINT32 *sorted = &raster->poly_sorted_list[chunk->start];
+	plane clip_plane;
+	UINT32 i;
+
+	clip_plane.normal.x = 0;
+	clip_plane.normal.y = 0;
+	clip_plane.normal.pz = 1;
+	clip_plane.distance = 0;
+
+	for( i = 0; i < chunk->count; i++ )
+	{
+		m2_polygon *poly = &raster->poly_list[chunk->start + i];
+		poly_vertex verts[10];
+		INT32 clipped_verts;
+
+		sorted[i] = chunk->start + i;
+
+		/* do near z clipping */
+		clipped_verts = clip_polygon( poly->v, poly->num_vertices, &clip_plane, verts );
+
+		if ( clipped_verts <= 2 )
+		{
+			poly->num_vertices = 0;
+			poly->z = 0;
+			continue;
+		}
+
+		/* set the object z-sort value */
+		poly->z = float_to_zval( poly->zvalue );
+
+		/* project the clipped vertices */
+		model2_3d_project( verts, clipped_verts, poly->center );
+
+		memcpy( poly->v, verts, clipped_verts * sizeof( poly_vertex ) );
+		poly->num_vertices = clipped_verts;
+	}
+
+	/* a stable sort keeps polygons with the same Z in submission order */
+	std::stable_sort( sorted, sorted + chunk->count, [raster]( UINT32 a, UINT32 b ) { return raster->poly_list[a].z > raster->poly_list[b].z; } );
+
+	return nullptr;
+}
+
 /* 3D Rasterizer frame start: Resets frame variables */
 static void model2_3d_frame_start( model2_state *state )
 {
 	raster_state *raster = state->m_raster;
 
-	/* reset the triangle list index */
+	/* reset the triangle and polygon list indices */
 	raster->tri_list_index = 0;
+	raster->poly_list_index = 0;
+}
+
+/* 3D Rasterizer geometry: clips, projects and Z-sorts this frame's polygons into the triangle list */
+static void model2_3d_process_polygons( raster_state *raster )
+{
+	UINT32 count = raster->poly_list_index;
+	UINT32 *sorted = raster->poly_sorted_list;
+	UINT32 numchunks = (count + POLYGON_CHUNK - 1) / POLYGON_CHUNK;
+	UINT32 i, width;
+
+	for( i = 0; i < numchunks; i++ )
+	{
+		raster->chunks[i].raster = raster;
+		raster->chunks[i].start = i * POLYGON_CHUNK;
+		raster->chunks[i].count = std::min<UINT32>( POLYGON_CHUNK, count - i * POLYGON_CHUNK );
+		raster->chunks[i].claimed = false;
+	}
+
+	/* clip and sort the runs in parallel when there's more than one */
+	if ( raster->queue != nullptr && numchunks > 1 )
+	{
+		osd_work_item_queue_multiple( raster->queue, model2_3d_process_chunk, numchunks, raster->chunks, sizeof( m2_geometry_chunk ), WORK_ITEM_FLAG_AUTO_RELEASE );
+		if ( !osd_work_queue_wait( raster->queue, osd_ticks_per_second() * 100 ) )
+		{
+			/* the runs must all be sorted before they are merged; do whichever are still unclaimed here */
+			for( i = 0; i < numchunks; i++ )
+				model2_3d_process_chunk( &raster->chunks[i], 0 );
+			if ( !osd_work_queue_wait( raster->queue, osd_ticks_per_second() * 100 ) )
+				fatalerror( "SEGA 3D: geometry work queue stalled\n" );
+		}
+	}
+	else
+	{
+		for( i = 0; i < numchunks; i++ )
+			model2_3d_process_chunk( &raster->chunks[i], 0 );
+	}
 
-	/* reset the sorted z list */
-	memset( raster->tri_sorted_list, 0, 0x10000 * sizeof( triangle * ) );
+	/* merge the sorted runs pairwise; ties go to the earlier run, so the order matches a serial Z-sort */
+	auto zcompare = [raster]( UINT32 a, UINT32 b ) { return raster->poly_list[a].z > raster->poly_list[b].z; };
+	for( width = POLYGON_CHUNK; width < count; width *= 2 )
+	{
+		for( i = 0; i + width < count; i += 2 * width )
+			std::inplace_merge( sorted + i, sorted + i + width, sorted + std::min( i + 2 * width, count ), zcompare );
+	}
+
+	/* go through the sorted polygons, adding triangles */
+	for( i = 0; i < count; i++ )
+	{
+		m2_polygon *poly = &raster->poly_list[sorted[i]];
 
-	/* reset the min-max sortable Z values */
-	raster->min_z = 0xFFFF;
-	raster->max_z = 0;
+		for( UINT32 v = 2; v < poly->num_vertices; v++ )
+		{
+			triangle *tri = &raster->tri_list[raster->tri_list_index++];
+
+			if ( raster->tri_list_index >= MAX_TRIANGLES )
+			{
+				fatalerror( "SEGA 3D: Max triangle limit exceeded\n" );
+			}
+
+			/* copy the object information */
+			tri->next = nullptr;
+			tri->z = poly->z;
+			memcpy( tri->texheader, poly->texheader, sizeof( tri->texheader ) );
+			tri->luma = poly->luma;
+			memcpy( tri->viewport, poly->viewport, sizeof( tri->viewport ) );
+			memcpy( tri->center, poly->center, sizeof( tri->center ) );
+
+			memcpy( &tri->v[0], &poly->v[0], sizeof( poly_vertex ) );
+			memcpy( &tri->v[1], &poly->v[v-1], sizeof( poly_vertex ) );
+			memcpy( &tri->v[2], &poly->v[v], sizeof( poly_vertex ) );
+		}
+	}
 }
 
 void model2_state::model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &cliprect )
 {
 	raster_state *raster = m_raster;
-	INT32 z;
+	UINT32 i;
+
+	/* clip, project and sort the polygons we got this frame */
+	model2_3d_process_polygons( raster );
 
 	/* if we have nothing to render, bail */
 	if ( raster->tri_list_index == 0 )
@@ -912,8 +959,6 @@ void model2_state::model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &c
 #if MODEL2_VIDEO_DEBUG
 	if (machine().input().code_pressed(KEYCODE_Q))
 	{
-		UINT32  i;
-
 		FILE *f = fopen( "triangles.txt", "w" );
 
 		if ( f )
@@ -940,7 +985,7 @@ void model2_state::model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &c
 				fprintf( f, "\n---\n\n" );
 			}
 
-			fprintf( f, "min_z = %04x, max_z = %04x\n", raster->min_z, raster->max_z );
+			fprintf( f, "min_z = %04x, max_z = %04x\n", raster->tri_list[raster->tri_list_index - 1].z, raster->tri_list[0].z );
 
 			fclose( f );
 		}
@@ -949,26 +994,10 @@ void model2_state::model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &c
 
 	m_poly->destmap().fill(0x00000000, cliprect);
 
-	/* go through the Z levels, and render each bucket */
-	for( z = raster->max_z; z >= raster->min_z; z-- )
-	{
-		/* see if we have items at this z level */
-		if ( raster->tri_sorted_list[z] != nullptr )
-		{
-			/* get a pointer to the first triangle */
-			triangle *tri = raster->tri_sorted_list[z];
-
-			/* and loop clipping and rendering each triangle */
-			while( tri != nullptr )
-			{
-				/* project and render */
-				model2_3d_project( tri );
-				m_poly->model2_3d_render(tri, cliprect);
+	/* the triangle list is already projected and in Z-sorted order, render it */
+	for( i = 0; i < raster->tri_list_index; i++ )
+		m_poly->model2_3d_render(&raster->tri_list[i], cliprect);
 
-				tri = (triangle *)tri->next;
-			}
-		}
-	}
 	m_poly->wait("End of frame");
 
 	copybitmap_trans(bitmap, m_poly->destmap(), 0, 0, 0, 0, cliprect, 0x00000000);
@@ -2584,6 +2613,13 @@ static void geo_parse( model2_state *state )
 /***********************************************************************************************/
 
 
+void model2_state::model2_exit()
+{
+	if (m_raster->queue != nullptr)
+		osd_work_queue_free(m_raster->queue);
+	m_raster->queue = nullptr;
+}
+
 VIDEO_START_MEMBER(model2_state,model2)
 {
 	const rectangle &visarea = m_screen->visible_area();
@@ -2596,6 +2632,8 @@ VIDEO_START_MEMBER(model2_state,model2)
 
 	/* initialize the hardware rasterizer */
 	model2_3d_init( machine(), (UINT16*)memregion("user3")->base() );
+	m_raster->queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(model2_state::model2_exit), this));
 
 	/* initialize the geometry engine */
 	geo_init( machine(), (UINT32*)memregion("user2")->base() );
@@ -103,6 +103,9 @@ void n64_state::video_start()
 
 	m_rdp->m_aux_buf = make_unique_clear<UINT8[]>(EXTENT_AUX_COUNT);
 
+	// nothing may still be rendering into RDRAM while it is saved
+	machine().save().register_presave(save_prepost_delegate(FUNC(n64_rdp::presave_idle), m_rdp));
+
 	if (LOG_RDP_EXECUTION)
 	{
 		rdp_exec = fopen("rdp_execute.txt", "wt");
@@ -157,6 +160,7 @@ UINT32 n64_state::screen_update_n64(screen_device &screen, bitmap_rgb32 &bitmap,
 		return 0;
 	}
 
+	rdp()->wait_idle("screen update");
 	n64->video_update(bitmap);
 
 	return 0;
@@ -2037,6 +2041,13 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 
 	INT32 xfrac = ((xright >> 8) & 0xff);
 
+	// span aux data stays in use until the spans are rendered, so only rewind once everything in flight is done
+	const UINT32 aux_needed = (((ylfar - ycur) >> 2) + 1) * sizeof(rdp_span_aux);
+	if (m_aux_buf_ptr + aux_needed >= EXTENT_AUX_COUNT)
+	{
+		wait_idle("span aux buffer full");
+	}
+
 	const INT32 clipy1 = m_scissor.m_yh;
 	const INT32 clipy2 = m_scissor.m_yl;
 
@@ -2199,7 +2210,6 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 	{
 		render_spans(yh >> 2, yl >> 2, tilenum, flip ? true : false, spans, rect, object);
 	}
-	m_aux_buf_ptr = 0;  // Spans can be reused once render completes
 	//wait("draw_triangle");
 }
 
@@ -2386,7 +2396,8 @@ void n64_rdp::cmd_sync_tile(UINT32 w1, UINT32 w2)
 
 void n64_rdp::cmd_sync_full(UINT32 w1, UINT32 w2)
 {
-	//wait("SyncFull");
+	// the CPU may look at the frame as soon as it sees the interrupt
+	wait_idle("SyncFull");
 	dp_full_sync(*m_machine);
 }
 
@@ -2502,6 +2513,9 @@ void n64_rdp::cmd_load_tlut(UINT32 w1, UINT32 w2)
 
 	const INT32 count = ((sh >> 2) - (sl >> 2) + 1) << 2;
 
+	const UINT32 tlut_start = m_misc_state.m_ti_address + (tl >> 2) * (m_misc_state.m_ti_width << 1) + (sl >> 1);
+	wait_for_writes(tlut_start, tlut_start + (count >> 1) + 2, "LoadTLUT");
+
 	switch (m_misc_state.m_ti_size)
 	{
 		case PIXEL_SIZE_16BIT:
@@ -2584,6 +2598,8 @@ void n64_rdp::cmd_load_block(UINT32 w1, UINT32 w2)
 
 	const UINT32 src = (m_misc_state.m_ti_address >> 1) + (tl * tiwinwords) + slinwords;
 
+	wait_for_writes(src << 1, (src << 1) + (width << 3), "LoadBlock");
+
 	if (dxt != 0)
 	{
 		INT32 j = 0;
@@ -2733,6 +2749,9 @@ void n64_rdp::cmd_load_tile(UINT32 w1, UINT32 w2)
 
 	const INT32 width = (sh - sl) + 1;
 	const INT32 height = (th - tl) + 1;
+
+	const UINT32 ti_line_bytes = (m_misc_state.m_ti_width << m_misc_state.m_ti_size) >> 1;
+	wait_for_writes(m_misc_state.m_ti_address + tl * ti_line_bytes, m_misc_state.m_ti_address + (th + 1) * ti_line_bytes, "LoadTile");
 /*
     INT32 topad;
     if (m_misc_state.m_ti_size < 3)
@@ -2977,21 +2996,38 @@ void n64_rdp::cmd_set_texture_image(UINT32 w1, UINT32 w2)
 	m_misc_state.m_ti_address = w2 & 0x01ffffff;
 }
 
+// primitives still rendering are only ordered against later ones by scanline,
+// so before drawing into an image that moves or changes pitch over pixels not
+// yet written, let them finish; an image spans at most 1024 scissored lines
 void n64_rdp::cmd_set_mask_image(UINT32 w1, UINT32 w2)
 {
-	//wait("SetMaskImage");
+	const UINT32 zb_address = w2 & 0x01ffffff;
+	if (zb_address != m_misc_state.m_zb_address)
+	{
+		wait_for_writes(zb_address, zb_address + 1024 * (m_misc_state.m_fb_width << 1), "SetMaskImage");
+	}
 
-	m_misc_state.m_zb_address = w2 & 0x01ffffff;
+	m_misc_state.m_zb_address = zb_address;
 }
 
 void n64_rdp::cmd_set_color_image(UINT32 w1, UINT32 w2)
 {
-	//wait("SetColorImage");
+	const INT32 fb_size     = (w1 >> 19) & 0x3;
+	const INT32 fb_width    = (w1 & 0x3ff) + 1;
+	const UINT32 fb_address = w2 & 0x01ffffff;
+	if (fb_address != m_misc_state.m_fb_address || fb_size != m_misc_state.m_fb_size || fb_width != m_misc_state.m_fb_width)
+	{
+		wait_for_writes(fb_address, fb_address + 1024 * ((fb_width << fb_size) >> 1), "SetColorImage");
+	}
+	if (fb_width != m_misc_state.m_fb_width)
+	{
+		wait_for_writes(m_misc_state.m_zb_address, m_misc_state.m_zb_address + 1024 * (fb_width << 1), "SetColorImage");
+	}
 
 	m_misc_state.m_fb_format  = (w1 >> 21) & 0x7;
-	m_misc_state.m_fb_size    = (w1 >> 19) & 0x3;
-	m_misc_state.m_fb_width   = (w1 & 0x3ff) + 1;
-	m_misc_state.m_fb_address = w2 & 0x01ffffff;
+	m_misc_state.m_fb_size    = fb_size;
+	m_misc_state.m_fb_width   = fb_width;
+	m_misc_state.m_fb_address = fb_address;
 
 	if (m_misc_state.m_fb_format < 2 || m_misc_state.m_fb_format > 32) // Jet Force Gemini sets the format to 4, Intensity.  Protection?
 	{
@@ -3136,6 +3172,9 @@ n64_rdp::n64_rdp(n64_state &state, UINT32* rdram, UINT32* dmem) : poly_manager<U
 	m_aux_buf = nullptr;
 	m_pipe_clean = true;
 
+	m_pending_write_start = ~0;
+	m_pending_write_end = 0;
+
 	m_pending_mode_block = false;
 
 	m_cmd_ptr = 0;
@@ -3261,7 +3300,35 @@ void n64_rdp::render_spans(INT32 start, INT32 end, INT32 tilenum, bool flip, ext
 			render_triangle_custom(clip, render_delegate(FUNC(n64_rdp::span_draw_fill), this), start, (end - start) + 1, spans + offset);
 			break;
 	}
-	wait("render spans");
+
+	// everything about the primitive is in the object and span aux data, so let it render
+	// while we move on; just remember which color and depth lines it can touch
+	const UINT32 fb_line_bytes = (m_misc_state.m_fb_width << m_misc_state.m_fb_size) >> 1;
+	m_pending_write_start = std::min(m_pending_write_start, m_misc_state.m_fb_address + start * fb_line_bytes);
+	m_pending_write_end = std::max(m_pending_write_end, m_misc_state.m_fb_address + (end + 1) * fb_line_bytes);
+	if (m_other_modes.z_update_en)
+	{
+		const UINT32 zb_line_bytes = m_misc_state.m_fb_width << 1;
+		m_pending_write_start = std::min(m_pending_write_start, m_misc_state.m_zb_address + start * zb_line_bytes);
+		m_pending_write_end = std::max(m_pending_write_end, m_misc_state.m_zb_address + (end + 1) * zb_line_bytes);
+	}
+}
+
+void n64_rdp::wait_idle(const char *reason)
+{
+	wait(reason);
+	m_aux_buf_ptr = 0;
+	m_pending_write_start = ~0;
+	m_pending_write_end = 0;
+}
+
+// texture loads copy RDRAM into TMEM right away, so wait if they read something still being drawn
+void n64_rdp::wait_for_writes(UINT32 start, UINT32 end, const char *reason)
+{
+	if (start < m_pending_write_end && end > m_pending_write_start)
+	{
+		wait_idle(reason);
+	}
 }
 
 void n64_rdp::rgbaz_clip(INT32 sr, INT32 sg, INT32 sb, INT32 sa, INT32* sz, rdp_span_aux* userdata)
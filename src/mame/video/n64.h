@@ -311,6 +311,14 @@ public:
 	UINT32          m_aux_buf_ptr;
 	UINT32          m_aux_buf_index;
 
+	// RDRAM byte range written by primitives that may still be rendering
+	UINT32          m_pending_write_start;
+	UINT32          m_pending_write_end;
+
+	void            wait_idle(const char *reason);
+	void            presave_idle() { wait_idle("pre-save"); }
+	void            wait_for_writes(UINT32 start, UINT32 end, const char *reason);
+
 	bool            rdp_range_check(UINT32 addr);
 
 	n64_tile_t      m_tiles[8];
@@ -94,6 +94,11 @@ READ16_MEMBER(neogeo_state::paletteram_r)
 WRITE16_MEMBER(neogeo_state::paletteram_w)
 {
 	offset += m_palette_bank;
+
+	/* lines waiting to be drawn use the pens as they are now */
+	if (((m_paletteram[offset] ^ data) & mem_mask) != 0)
+		m_screen->update_deferred();
+
 	data = COMBINE_DATA(&m_paletteram[offset]);
 
 	int dark = data >> 15;
@@ -171,6 +176,33 @@ UINT32 neogeo_state::screen_update_neogeo(screen_device &screen, bitmap_rgb32 &b
 }
 
 
+/* deferred updates: capture each line as the beam reaches it, draw them all
+   at the end of the frame */
+void neogeo_state::screen_capture_neogeo(screen_device &screen, const rectangle &cliprect, int region)
+{
+	if (region == 0)
+	{
+		m_deferred_lines.clear();
+		m_deferred_bg.clear();
+	}
+
+	m_deferred_bg.push_back(*m_bg_pen);
+	m_deferred_lines.emplace_back();
+	m_sprgen->capture_line(cliprect.min_y, m_deferred_lines.back());
+}
+
+
+void neogeo_state::screen_draw_neogeo(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect, int region)
+{
+	// fill with background color first
+	bitmap.fill(m_deferred_bg[region], cliprect);
+
+	m_sprgen->draw_sprites(bitmap, cliprect.min_y, m_deferred_lines[region]);
+
+	m_sprgen->draw_fixed_layer(bitmap, cliprect.min_y, m_deferred_lines[region]);
+}
+
+
 
 /*************************************
  *
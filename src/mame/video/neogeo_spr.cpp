@@ -94,6 +94,11 @@ UINT16 neosprite_base_device::get_videoram_data()
 
 void neosprite_base_device::set_videoram_data(UINT16 data)
 {
+	/* lines waiting to be drawn read sprite and fix data straight from here;
+	   the per-line sprite lists are captured with them */
+	if (m_vram_offset < 0x8600 && m_videoram[m_vram_offset] != data)
+		m_screen->update_deferred();
+
 	m_videoram[m_vram_offset] = data;
 
 	/* auto increment/decrement the current offset - A15 is NOT affected */
@@ -178,16 +183,24 @@ void neosprite_base_device::neogeo_set_fixed_layer_source(UINT8 data)
 
 
 void neosprite_base_device::draw_fixed_layer(bitmap_rgb32 &bitmap, int scanline)
+{
+	neosprite_line_state state;
+	capture_line(scanline, state);
+	draw_fixed_layer(bitmap, scanline, state);
+}
+
+
+void neosprite_base_device::draw_fixed_layer(bitmap_rgb32 &bitmap, int scanline, const neosprite_line_state &state)
 {
 	int x;
 
-	UINT8* gfx_base = m_fixed_layer_source ? m_region_fixed : m_region_fixedbios->base();
-	UINT32 addr_mask = ( m_fixed_layer_source ? m_region_fixed_size : m_region_fixedbios->bytes() ) - 1;
+	UINT8* gfx_base = state.fixed_layer_source ? m_region_fixed : m_region_fixedbios->base();
+	UINT32 addr_mask = ( state.fixed_layer_source ? m_region_fixed_size : m_region_fixedbios->bytes() ) - 1;
 	UINT16 *video_data = &m_videoram_drawsource[0x7000 | (scanline >> 3)];
 	UINT32 *pixel_addr = &bitmap.pix32(scanline, NEOGEO_HBEND);
 
 	int garouoffsets[32];
-	int banked = m_fixed_layer_source && (addr_mask > 0x1ffff);
+	int banked = state.fixed_layer_source && (addr_mask > 0x1ffff);
 
 	/* thanks to Mr K for the garou & kof2000 banking info */
 	/* Build line banking table for Garou & MS3 before starting render */
@@ -234,7 +247,7 @@ void neosprite_base_device::draw_fixed_layer(bitmap_rgb32 &bitmap, int scanline)
 
 			const pen_t *char_pens;
 
-			char_pens = &m_pens[code_and_palette >> 12 << m_bppshift];
+			char_pens = &state.pens[code_and_palette >> 12 << m_bppshift];
 
 
 			static const UINT32 pix_offsets[] = { 0x10, 0x18, 0x00, 0x08 };
@@ -271,7 +284,7 @@ inline void neosprite_base_device::draw_fixed_layer_2pixels(UINT32*&pixel_addr,
  *************************************/
 
 #define MAX_SPRITES_PER_SCREEN    (381)
-#define MAX_SPRITES_PER_LINE      (96)
+#define MAX_SPRITES_PER_LINE      (NEOGEO_MAX_SPRITES_PER_LINE)
 
 
 /* horizontal zoom table - verified on real hardware */
@@ -305,7 +318,32 @@ inline bool neosprite_base_device::sprite_on_scanline(int scanline, int y, int r
 
 
 
+/* copy what drawing the line needs and video RAM doesn't keep: the active
+   list is rebuilt every line, the rest are registers */
+void neosprite_base_device::capture_line(int scanline, neosprite_line_state &state)
+{
+	/* select the active list */
+	if (scanline & 0x01)
+		memcpy(state.sprite_list, &m_videoram_drawsource[0x8680], sizeof(state.sprite_list));
+	else
+		memcpy(state.sprite_list, &m_videoram_drawsource[0x8600], sizeof(state.sprite_list));
+
+	state.pens = m_pens;
+	state.auto_animation_disabled = m_auto_animation_disabled;
+	state.auto_animation_counter = m_auto_animation_counter;
+	state.fixed_layer_source = m_fixed_layer_source;
+}
+
+
 void neosprite_base_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
+{
+	neosprite_line_state state;
+	capture_line(scanline, state);
+	draw_sprites(bitmap, scanline, state);
+}
+
+
+void neosprite_base_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline, const neosprite_line_state &state)
 {
 	int sprite_index;
 	int max_sprite_index;
@@ -315,13 +353,7 @@ void neosprite_base_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
 	int rows = 0;
 	int zoom_y = 0;
 	int zoom_x = 0;
-	UINT16 *sprite_list;
-
-	/* select the active list */
-	if (scanline & 0x01)
-		sprite_list = &m_videoram_drawsource[0x8680];
-	else
-		sprite_list = &m_videoram_drawsource[0x8600];
+	const UINT16 *sprite_list = state.sprite_list;
 
 	/* optimization -- find last non-zero entry and only draw that many +1
 	   sprite.  This is not 100% correct as the hardware will keep drawing
@@ -412,12 +444,12 @@ void neosprite_base_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
 			code = ((attr << 12) & 0x70000) | m_videoram_drawsource[attr_and_code_offs];
 
 			/* substitute auto animation bits */
-			if (!m_auto_animation_disabled)
+			if (!state.auto_animation_disabled)
 			{
 				if (attr & 0x0008)
-					code = (code & ~0x07) | (m_auto_animation_counter & 0x07);
+					code = (code & ~0x07) | (state.auto_animation_counter & 0x07);
 				else if (attr & 0x0004)
-					code = (code & ~0x03) | (m_auto_animation_counter & 0x03);
+					code = (code & ~0x03) | (state.auto_animation_counter & 0x03);
 			}
 
 			/* vertical flip? */
@@ -430,7 +462,7 @@ void neosprite_base_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
 			int gfx_base = ((code << 8) | (sprite_y << 4)) & m_sprite_gfx_address_mask;
 
 
-			line_pens = &m_pens[attr >> 8 << m_bppshift];
+			line_pens = &state.pens[attr >> 8 << m_bppshift];
 
 
 			/* horizontal flip? */
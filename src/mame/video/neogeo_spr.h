@@ -16,6 +16,18 @@
 #define NEOGEO_VBEND                            (0x010)
 #define NEOGEO_VBSTART                          (0x0f0)
 #define NEOGEO_VSSTART                          (0x100)
+#define NEOGEO_MAX_SPRITES_PER_LINE             (96)
+
+// what drawing a scanline needs beyond video RAM proper; captured when a
+// line is drawn later than it is reached
+struct neosprite_line_state
+{
+	UINT16          sprite_list[NEOGEO_MAX_SPRITES_PER_LINE + 1];
+	const pen_t *   pens;
+	UINT8           auto_animation_disabled;
+	UINT8           auto_animation_counter;
+	UINT8           fixed_layer_source;
+};
 
 // todo, sort out what needs to be public and make the rest private/protected
 class neosprite_base_device : public device_t
@@ -29,6 +41,7 @@ public:
 
 	virtual void draw_fixed_layer_2pixels(UINT32*&pixel_addr, int offset, UINT8* gfx_base, const pen_t* char_pens);
 	void draw_fixed_layer(bitmap_rgb32 &bitmap, int scanline);
+	void draw_fixed_layer(bitmap_rgb32 &bitmap, int scanline, const neosprite_line_state &state);
 	void set_videoram_offset(UINT16 data);
 	UINT16 get_videoram_data();
 	void set_videoram_data(UINT16 data);
@@ -43,6 +56,8 @@ public:
 	inline bool sprite_on_scanline(int scanline, int y, int rows);
 	virtual void draw_pixel(int romaddr, UINT32* dst, const pen_t *line_pens) = 0;
 	void draw_sprites(bitmap_rgb32 &bitmap, int scanline);
+	void draw_sprites(bitmap_rgb32 &bitmap, int scanline, const neosprite_line_state &state);
+	void capture_line(int scanline, neosprite_line_state &state);
 	void parse_sprites(int scanline);
 	void create_sprite_line_timer();
 	void start_sprite_line_timer();
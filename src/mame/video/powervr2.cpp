@@ -681,6 +681,7 @@ void powervr2_device::tex_get_info(texinfo *t)
 	t->palbase = 0;
 	t->vqbase = t->address;
 	t->blend = use_alpha ? blend_functions[t->blend_mode] : bl10;
+	t->texels = nullptr;
 
 //  fprintf(stderr, "tex %d %d %d %d\n", t->pf, t->mode, pal_ram_ctrl, t->mipmapped);
 	if(!t->textured)
@@ -909,6 +910,155 @@ void powervr2_device::tex_get_info(texinfo *t)
 
 }
 
+// texel fetch, from the decoded texture when the cache has one
+inline UINT32 powervr2_device::tex_r(texinfo *t, float x, float y)
+{
+	if (t->texels != nullptr)
+		return t->texels[t->v_func(y, t->sizey) * t->sizex + t->u_func(x, t->sizex)];
+	return (this->*(t->r))(t, x, y);
+}
+
+// find the texture memory bytes and palette entries a texture is decoded
+// from; false for textures the cache doesn't handle
+bool powervr2_device::tex_source_range(const texinfo *t, UINT32 &start, UINT32 &end, int &palsize)
+{
+	if (!t->textured || t->r == &powervr2_device::tex_r_default)
+		return false;
+
+	UINT64 texels = (UINT64)t->sizex * t->sizey;
+	UINT64 first = t->address, last;
+	palsize = 0;
+
+	switch (t->pf)
+	{
+	case 0: case 1: case 2: case 3: // 1555, 565, 4444, yuv422
+		if (t->mode == 0)
+			last = first + texels * 2;
+		else if (t->mode == 1)
+			last = first + ((UINT64)t->stride * (t->sizey - 1) + t->sizex) * 2;
+		else if (t->pf != 3)
+		{
+			first = t->vqbase;
+			last = t->address + texels / 4;
+		}
+		else
+			return false;
+		break;
+
+	case 5: // 4bpp palette
+	case 6: // 8bpp palette
+		palsize = (t->pf == 5) ? 16 : 256;
+		if (t->mode < 2)
+			last = first + ((t->pf == 5) ? texels / 2 : texels);
+		else
+		{
+			first = t->vqbase;
+			last = t->address + texels / 4;
+		}
+		break;
+
+	default:
+		return false;
+	}
+
+	if (last > dc_texture_ram_size || first >= last)
+		return false;
+	start = first;
+	end = last;
+	return true;
+}
+
+UINT64 powervr2_device::tex_source_hash(UINT32 start, UINT32 end, int palbase, int palsize)
+{
+	UINT64 hash = 0;
+
+	for (UINT32 word = start >> 3; word < (end + 7) >> 3; word++)
+	{
+		hash = (hash + dc_texture_ram[word]) * U64(0x9e3779b97f4a7c15);
+		hash ^= hash >> 29;
+	}
+	for (int entry = 0; entry < palsize; entry++)
+	{
+		hash = (hash + palette[palbase + entry]) * U64(0x9e3779b97f4a7c15);
+		hash ^= hash >> 29;
+	}
+	return hash;
+}
+
+// point a texture at its decoded texels, decoding them if the cache doesn't
+// have them or what they came from has changed. Not all writes to texture
+// memory go through the PVR (the CPU maps it as plain RAM), so each texture
+// is checked against its source the first time it is used in a render
+void powervr2_device::tex_cache_bind(texinfo *t)
+{
+	UINT32 start, end;
+	int palsize;
+
+	t->texels = nullptr;
+	if (!tex_source_range(t, start, end, palsize))
+		return;
+
+	// everything the texels depend on is in the key, so an entry already
+	// bound in this render is never decoded again under a texture using it
+	texture_cache_key key = { t->address, t->vqbase, t->r, t->sizex, t->sizey, t->stride, t->palbase, t->cd };
+	texture_cache_entry &entry = texture_cache[key];
+
+	if (entry.texels.empty() || entry.checked != texture_cache_serial)
+	{
+		UINT64 hash = tex_source_hash(start, end, t->palbase, palsize);
+		if (entry.texels.empty() || hash != entry.hash)
+		{
+			// texel coordinates inside the texture come back unchanged from
+			// the wrap, flip and clamp functions, so this is what the reader
+			// would return for every sample landing on the texel
+			if (entry.texels.empty())
+			{
+				entry.texels.resize(t->sizex * t->sizey);
+				texture_cache_bytes += entry.texels.size() * sizeof(UINT32);
+			}
+			UINT32 *dest = &entry.texels[0];
+			for (int y = 0; y < t->sizey; y++)
+				for (int x = 0; x < t->sizex; x++)
+					*dest++ = (this->*(t->r))(t, (float)x, (float)y);
+			entry.hash = hash;
+		}
+		entry.checked = texture_cache_serial;
+	}
+	entry.used = texture_cache_serial;
+	t->texels = &entry.texels[0];
+}
+
+// drop textures that haven't been used for a while, then the least recently
+// used until the rest fit the budget; only called between renders
+void powervr2_device::tex_cache_expire()
+{
+	for (auto entry = texture_cache.begin(); entry != texture_cache.end(); )
+	{
+		if (texture_cache_serial - entry->second.used > TEXTURE_CACHE_EXPIRE)
+		{
+			texture_cache_bytes -= entry->second.texels.size() * sizeof(UINT32);
+			entry = texture_cache.erase(entry);
+		}
+		else
+			++entry;
+	}
+
+	if (texture_cache_bytes <= TEXTURE_CACHE_BYTES)
+		return;
+
+	std::vector<decltype(texture_cache)::iterator> entries;
+	for (auto entry = texture_cache.begin(); entry != texture_cache.end(); ++entry)
+		entries.push_back(entry);
+	std::sort(entries.begin(), entries.end(), [this](decltype(texture_cache)::iterator a, decltype(texture_cache)::iterator b) {
+		return texture_cache_serial - a->second.used > texture_cache_serial - b->second.used;
+	});
+	for (auto entry = entries.begin(); entry != entries.end() && texture_cache_bytes > TEXTURE_CACHE_BYTES; ++entry)
+	{
+		texture_cache_bytes -= (*entry)->second.texels.size() * sizeof(UINT32);
+		texture_cache.erase(*entry);
+	}
+}
+
 READ32_MEMBER( powervr2_device::id_r )
 {
 	return 0x17fd11db;
@@ -2228,16 +2378,16 @@ void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, flo
 			float u = ul/wl;
 			float v = vl/wl;
 
-			c = (this->*(ti->r))(ti, u, v);
+			c = tex_r(ti, u, v);
 
 			// debug dip to turn on/off bilinear filtering, it's slooooow
 			if (debug_dip_status&0x1)
 			{
 				if(ti->filter_mode >= TEX_FILTER_BILINEAR)
 				{
-					UINT32 c1 = (this->*(ti->r))(ti, u+1.0f, v);
-					UINT32 c2 = (this->*(ti->r))(ti, u+1.0f, v+1.0f);
-					UINT32 c3 = (this->*(ti->r))(ti, u, v+1.0f);
+					UINT32 c1 = tex_r(ti, u+1.0f, v);
+					UINT32 c2 = tex_r(ti, u+1.0f, v+1.0f);
+					UINT32 c3 = tex_r(ti, u, v+1.0f);
 					c = bilinear_filter(c, c1, c2, c3, u, v);
 				}
 			}
@@ -2257,7 +2407,7 @@ void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, flo
 	}
 }
 
-void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+void powervr2_device::render_span(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti,
 									float y0, float y1,
 									float xl, float xr,
 									float ul, float ur,
@@ -2310,8 +2460,14 @@ void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
 	wl += dy*dwldy;
 	wr += dy*dwrdy;
 
+	// rows outside the clip are stepped over rather than skipped so that the
+	// ones inside come out the same whatever the clip
+	if(yy1 > clip.max_y + 1)
+		yy1 = clip.max_y + 1;
+
 	while(yy0 < yy1) {
-		render_hline(bitmap, ti, yy0, xl, xr, ul, ur, vl, vr, wl, wr);
+		if(yy0 >= clip.min_y)
+			render_hline(bitmap, ti, yy0, xl, xr, ul, ur, vl, vr, wl, wr);
 
 		xl += dxldy;
 		xr += dxrdy;
@@ -2356,7 +2512,7 @@ void powervr2_device::sort_vertices(const vert *v, int *i0, int *i1, int *i2)
 }
 
 
-void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v0, const vert *v1, const vert *v2)
+void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, const vert *v0, const vert *v1, const vert *v2)
 {
 	float dy01, dy02, dy12;
 
@@ -2390,41 +2546,59 @@ void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const
 			return;
 
 		if(v1->x > v0->x)
-			render_span(bitmap, ti, v1->y, v2->y, v0->x, v1->x, v0->u, v1->u, v0->v, v1->v, v0->w, v1->w, dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy);
+			render_span(bitmap, clip, ti, v1->y, v2->y, v0->x, v1->x, v0->u, v1->u, v0->v, v1->v, v0->w, v1->w, dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy);
 		else
-			render_span(bitmap, ti, v1->y, v2->y, v1->x, v0->x, v1->u, v0->u, v1->v, v0->v, v1->w, v0->w, dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy);
+			render_span(bitmap, clip, ti, v1->y, v2->y, v1->x, v0->x, v1->u, v0->u, v1->v, v0->v, v1->w, v0->w, dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy);
 
 	} else if(!dy12) {
 		if(v2->x > v1->x)
-			render_span(bitmap, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy);
+			render_span(bitmap, clip, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy);
 		else
-			render_span(bitmap, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy);
+			render_span(bitmap, clip, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy);
 
 	} else {
 		if(dx01dy < dx02dy) {
-			render_span(bitmap, ti, v0->y, v1->y,
+			render_span(bitmap, clip, ti, v0->y, v1->y,
 						v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w,
 						dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy);
-			render_span(bitmap, ti, v1->y, v2->y,
+			render_span(bitmap, clip, ti, v1->y, v2->y,
 						v1->x, v0->x + dx02dy*dy01, v1->u, v0->u + du02dy*dy01, v1->v, v0->v + dv02dy*dy01, v1->w, v0->w + dw02dy*dy01,
 						dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy);
 		} else {
-			render_span(bitmap, ti, v0->y, v1->y,
+			render_span(bitmap, clip, ti, v0->y, v1->y,
 						v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w,
 						dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy);
-			render_span(bitmap, ti, v1->y, v2->y,
+			render_span(bitmap, clip, ti, v1->y, v2->y,
 						v0->x + dx02dy*dy01, v1->x, v0->u + du02dy*dy01, v1->u, v0->v + dv02dy*dy01, v1->v, v0->w + dw02dy*dy01, v1->w,
 						dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy);
 		}
 	}
 }
 
-void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v)
+void powervr2_device::render_tri(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, const vert *v)
 {
 	int i0, i1, i2;
 
 	sort_vertices(v, &i0, &i1, &i2);
-	render_tri_sorted(bitmap, ti, v+i0, v+i1, v+i2);
+	render_tri_sorted(bitmap, clip, ti, v+i0, v+i1, v+i2);
+}
+
+// draw the triangles binned into a row of tiles, in the order they were received
+void powervr2_device::render_tile_row(tile_row &row)
+{
+	receiveddata &rd = grab[renderselect];
+
+	for (const tile_row_tri &tri : row.tris)
+		render_tri(*row.bitmap, row.clip, &rd.strips[tri.strip].ti, rd.verts + tri.vert);
+}
+
+void *powervr2_device::render_tile_row_callback(void *param, int threadid)
+{
+	tile_row *row = reinterpret_cast<tile_row *>(param);
+	if (row->claimed.exchange(true))
+		return nullptr;
+	row->device->render_tile_row(*row);
+	return nullptr;
 }
 
 void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap,const rectangle &cliprect)
@@ -2452,6 +2626,16 @@ void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap,const r
 	if(ns)
 		memset(wbuffer, 0x00, sizeof(wbuffer));
 
+	for (tile_row &row : tile_rows)
+	{
+		row.claimed = false;
+		row.bitmap = &bitmap;
+		row.tris.clear();
+	}
+	texture_cache_serial++;
+
+	// bin the triangles by the rows of tiles they touch; each row then draws
+	// its own in order, so rows can be drawn in parallel
 	for (int cs=0;cs < ns;cs++)
 	{
 		strip *ts = &grab[rs].strips[cs];
@@ -2461,6 +2645,8 @@ void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap,const r
 		if(ev == -1)
 			continue;
 
+		tex_cache_bind(&ts->ti);
+
 		for(i=sv; i <= ev; i++)
 		{
 			vert *tv = grab[rs].verts + i;
@@ -2468,13 +2654,40 @@ void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap,const r
 			tv->v = tv->v * ts->ti.sizey * tv->w;
 		}
 
+		if (debug_dip_status&0x2)
+			continue;
+
 		for(i=sv; i <= ev-2; i++)
 		{
-			if (!(debug_dip_status&0x2))
-				render_tri(bitmap, &ts->ti, grab[rs].verts + i);
-
+			const vert *tv = grab[rs].verts + i;
+			float miny = std::min(std::min(tv[0].y, tv[1].y), tv[2].y);
+			float maxy = std::max(std::max(tv[0].y, tv[1].y), tv[2].y);
+
+			// also drops triangles with NaN coordinates
+			if (!(miny < 480.0f && maxy >= 0.0f))
+				continue;
+
+			int first = (miny <= 0.0f) ? 0 : (int)miny / TILE_SIZE;
+			int last = (maxy >= 479.0f) ? NUM_TILE_ROWS - 1 : std::min(((int)maxy + 1) / TILE_SIZE, NUM_TILE_ROWS - 1);
+			for (int row = first; row <= last; row++)
+				tile_rows[row].tris.push_back(tile_row_tri{ cs, i });
 		}
 	}
+
+	osd_work_item_queue_multiple(work_queue, render_tile_row_callback, NUM_TILE_ROWS, tile_rows, sizeof(tile_rows[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+
+	// the rows read the texture cache and this grab, so every one has to be
+	// finished before either is released; on a timeout draw whatever no
+	// worker has started here
+	if (!osd_work_queue_wait(work_queue, osd_ticks_per_second() * 10))
+	{
+		for (tile_row &row : tile_rows)
+			render_tile_row_callback(&row, 0);
+		if (!osd_work_queue_wait(work_queue, osd_ticks_per_second() * 10))
+			throw emu_fatalerror("powervr2: tile row rendering stalled");
+	}
+	tex_cache_expire();
+
 	grab[rs].busy=0;
 }
 
@@ -3608,6 +3821,7 @@ void powervr2_device::pvr_dma_execute(address_space &space)
 powervr2_device::powervr2_device(const machine_config &mconfig, const char *tag, device_t *owner, UINT32 clock)
 	: device_t(mconfig, POWERVR2, "PowerVR 2", tag, owner, clock, "powervr2", __FILE__),
 		device_video_interface(mconfig, *this),
+		work_queue(nullptr),
 		irq_cb(*this),
 		m_mamedebug(*this, ":MAMEDEBUG")
 {
@@ -3633,6 +3847,16 @@ void powervr2_device::device_start()
 
 	fake_accumulationbuffer_bitmap = std::make_unique<bitmap_rgb32>(2048,2048);
 
+	for (int row = 0; row < NUM_TILE_ROWS; row++)
+	{
+		tile_rows[row].device = this;
+		tile_rows[row].bitmap = nullptr;
+		tile_rows[row].clip.set(0, 639, row * TILE_SIZE, row * TILE_SIZE + TILE_SIZE - 1);
+	}
+	work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	texture_cache_serial = 0;
+	texture_cache_bytes = 0;
+
 	softreset = 0;
 	param_base = 0;
 	region_base = 0;
@@ -3748,6 +3972,13 @@ void powervr2_device::device_start()
 	save_item(NAME(next_y));
 }
 
+void powervr2_device::device_stop()
+{
+	if (work_queue != nullptr)
+		osd_work_queue_free(work_queue);
+	work_queue = nullptr;
+}
+
 void powervr2_device::device_reset()
 {
 	softreset =                 0x00000007;
@@ -3782,6 +4013,7 @@ void powervr2_device::device_reset()
 
 	dc_state *state = machine().driver_data<dc_state>();
 	dc_texture_ram = state->dc_texture_ram.target();
+	dc_texture_ram_size = state->dc_texture_ram.bytes();
 	dc_framebuffer_ram = state->dc_framebuffer_ram.target();
 }
 
@@ -3,6 +3,8 @@
 #ifndef __POWERVR2_H__
 #define __POWERVR2_H__
 
+#include <atomic>
+
 #define MCFG_POWERVR2_ADD(_tag, _irq_cb)                                \
 	MCFG_DEVICE_ADD(_tag, POWERVR2, 0)                                  \
 	downcast<powervr2_device *>(device)->set_irq_cb(DEVCB_ ## _irq_cb);
@@ -12,6 +14,9 @@ class powervr2_device : public device_t,
 {
 public:
 	enum { NUM_BUFFERS = 4 };
+	enum { TILE_SIZE = 32, NUM_TILE_ROWS = 480 / TILE_SIZE };
+	enum { TEXTURE_CACHE_EXPIRE = 60 };    // renders a texture stays cached unused
+	enum { TEXTURE_CACHE_BYTES = 32 << 20 };    // decoded texels kept before the least recently used go
 	enum {
 		EOXFER_YUV_IRQ,
 		EOXFER_OPLST_IRQ,
@@ -54,7 +59,7 @@ public:
 
 
 	// the real accumulation buffer is a 32x32x8bpp buffer into which tiles get rendered before they get copied to the framebuffer
-	//  our implementation is not currently tile based, and thus the accumulation buffer is screen sized
+	//  our implementation bins triangles by rows of tiles instead, and thus the accumulation buffer is screen sized
 	std::unique_ptr<bitmap_rgb32> fake_accumulationbuffer_bitmap;
 
 	struct texinfo  {
@@ -69,6 +74,41 @@ public:
 		int (*u_func)(float uv, int size);
 		int (*v_func)(float uv, int size);
 		int palbase, cd;
+		const UINT32 *texels;   // decoded texture from the cache, bound at render time
+	};
+
+	// everything about a texture that its decoded texels depend on, other
+	// than the contents of the texture memory and palette it reads
+	struct texture_cache_key
+	{
+		UINT32 address, vqbase;
+		UINT32 (powervr2_device::*r)(struct texinfo *t, float x, float y);
+		int sizex, sizey, stride, palbase, cd;
+
+		bool operator==(const texture_cache_key &k) const
+		{
+			return address == k.address && vqbase == k.vqbase && r == k.r && sizex == k.sizex && sizey == k.sizey &&
+				stride == k.stride && palbase == k.palbase && cd == k.cd;
+		}
+	};
+
+	struct texture_cache_key_hash
+	{
+		size_t operator()(const texture_cache_key &k) const
+		{
+			UINT64 hash = ((UINT64)k.address << 32) ^ k.vqbase;
+			hash = (hash ^ ((k.sizex << 20) | (k.sizey << 8) | (k.palbase >> 4))) * U64(0x9e3779b97f4a7c15);
+			return (size_t)(hash ^ (hash >> 29) ^ ((UINT64)k.stride << 11) ^ k.cd);
+		}
+	};
+
+	// a fully decoded texture, checked against the texture memory and
+	// palette it came from once per render
+	struct texture_cache_entry
+	{
+		UINT64 hash;
+		UINT32 checked, used;       // render serials
+		std::vector<UINT32> texels;
 	};
 
 	typedef struct
@@ -82,6 +122,23 @@ public:
 		texinfo ti;
 	};
 
+	// a triangle binned into a row of tiles: its strip and first vertex
+	struct tile_row_tri
+	{
+		int strip, vert;
+	};
+
+	// a row of tiles, rasterized on its own by a work item, or by the
+	// render itself if the queue times out before a worker claims it
+	struct tile_row
+	{
+		std::atomic<bool> claimed;
+		powervr2_device *device;
+		bitmap_rgb32 *bitmap;
+		rectangle clip;
+		std::vector<tile_row_tri> tris;
+	};
+
 	struct receiveddata {
 		vert verts[65536];
 		strip strips[65536];
@@ -109,6 +166,11 @@ public:
 	receiveddata grab[NUM_BUFFERS];
 	int grabsel;
 	int grabsellast;
+	tile_row tile_rows[NUM_TILE_ROWS];
+	osd_work_queue *work_queue;
+	std::unordered_map<texture_cache_key, texture_cache_entry, texture_cache_key_hash> texture_cache;
+	UINT32 texture_cache_serial;
+	size_t texture_cache_bytes;     // size of the texels in texture_cache
 	UINT32 paracontrol,paratype,endofstrip,listtype,global_paratype,parameterconfig;
 	UINT32 groupcontrol,groupen,striplen,userclip;
 	UINT32 objcontrol,shadow,volume,coltype,texture,offfset,gouraud,uv16bit;
@@ -120,6 +182,7 @@ public:
 	float nontextured_fpal_a,nontextured_fpal_r,nontextured_fpal_g,nontextured_fpal_b;
 
 	UINT64 *dc_texture_ram;
+	UINT32 dc_texture_ram_size;
 	UINT64 *dc_framebuffer_ram;
 
 	UINT64 *pvr2_texture_ram;
@@ -280,6 +343,7 @@ public:
 protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_stop() override;
 
 private:
 	devcb_write8 irq_cb;
@@ -431,9 +495,14 @@ private:
 
 	UINT32 tex_r_default(texinfo *t, float x, float y);
 	void tex_get_info(texinfo *t);
+	inline UINT32 tex_r(texinfo *t, float x, float y);
+	bool tex_source_range(const texinfo *t, UINT32 &start, UINT32 &end, int &palsize);
+	UINT64 tex_source_hash(UINT32 start, UINT32 end, int palbase, int palsize);
+	void tex_cache_bind(texinfo *t);
+	void tex_cache_expire();
 
 	void render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, float xl, float xr, float ul, float ur, float vl, float vr, float wl, float wr);
-	void render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+	void render_span(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti,
 						float y0, float y1,
 						float xl, float xr,
 						float ul, float ur,
@@ -444,8 +513,10 @@ private:
 						float dvldy, float dvrdy,
 						float dwldy, float dwrdy);
 	void sort_vertices(const vert *v, int *i0, int *i1, int *i2);
-	void render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v0, const vert *v1, const vert *v2);
-	void render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v);
+	void render_tri_sorted(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, const vert *v0, const vert *v1, const vert *v2);
+	void render_tri(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, const vert *v);
+	void render_tile_row(tile_row &row);
+	static void *render_tile_row_callback(void *param, int threadid);
 	void render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void pvr_accumulationbuffer_to_framebuffer(address_space &space, int x, int y);
 	void pvr_drawframebuffer(bitmap_rgb32 &bitmap,const rectangle &cliprect);
@@ -470,6 +470,7 @@ void osd_sleep(osd_ticks_t duration);
 #define WORK_QUEUE_FLAG_IO          0x0001
 #define WORK_QUEUE_FLAG_MULTI       0x0002
 #define WORK_QUEUE_FLAG_HIGH_FREQ   0x0004
+#define WORK_QUEUE_FLAG_AUDIO       0x0008
 
 /* these flags can be set when queueing a work item to indicate how to handle
    its deconstruction */
@@ -506,6 +507,10 @@ typedef void *(*osd_work_callback)(void *param, int threadid);
                 general, this implies doing some spin-waiting internally
                 before falling back to OS-specific synchronization
 
+            WORK_QUEUE_FLAG_AUDIO - indicates that the work queue does sound
+                generation; the OSD may give such queues a thread budget
+                separate from video and I/O queues
+
     Return value:
 
         A pointer to an allocated osd_work_queue object.
@@ -32,6 +32,10 @@
 #include <pthread.h>
 #endif
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #if defined(OSD_SDL) || defined(__LIBRETRO__)
 typedef void *PVOID;
 #endif
@@ -51,6 +55,9 @@ typedef void *PVOID;
 
 #define SPIN_LOOP_TIME          (osd_ticks_per_second() / 10000)
 
+// items a pool thread processes from one queue before looking at the others
+#define WORK_POOL_BATCH_ITEMS   (16)
+
 //============================================================
 //  MACROS
 //============================================================
@@ -96,17 +103,27 @@ int osd_get_num_processors(void)
 	return MIN(std::thread::hardware_concurrency(), 4);
 }
 
+
 //============================================================
 //  TYPE DEFINITIONS
 //============================================================
 
+struct work_pool;
+
+// classes of queues with separate thread budgets, see osd_work_policy
+enum
+{
+	WORK_CLASS_RENDER = 0,
+	WORK_CLASS_AUDIO,
+	WORK_CLASS_IO,
+	WORK_CLASS_COUNT
+};
+
 struct work_thread_info
 {
-	work_thread_info(UINT32 aid, osd_work_queue &aqueue)
-	: queue(aqueue)
+	work_thread_info(UINT32 aid, work_pool *apool)
+	: pool(apool)
 	, handle(nullptr)
-	, wakeevent(FALSE, FALSE)  // auto-reset, not signalled
-	, active(0)
 	, id(aid)
 #if KEEP_STATISTICS
 	, itemsdone(0)
@@ -117,10 +134,8 @@ struct work_thread_info
 #endif
 	{
 	}
-	osd_work_queue &    queue;          // pointer back to the queue
+	work_pool *         pool;           // pool we belong to (nullptr for callers)
 	std::thread *       handle;         // handle to the thread
-	osd_event           wakeevent;      // wake event for the thread
-	std::atomic<INT32>  active;         // are we actively processing work?
 	UINT32              id;
 
 #if KEEP_STATISTICS
@@ -133,6 +148,39 @@ struct work_thread_info
 };
 
 
+// a single set of worker threads serves every queue in the process; each
+// queue keeps its own list of items and a cap on how many of the threads
+// may work on it at once
+struct work_pool
+{
+	work_pool()
+	: sequence(0)
+	, rotate(0)
+	, refcount(0)
+	, exiting(false)
+	, firstcpu(OSD_WORK_POLICY_AUTO)
+	{
+		for (int index = 0; index < WORK_CLASS_COUNT; index++)
+		{
+			classthreads[index] = 0;
+			classactive[index] = 0;
+		}
+	}
+
+	std::mutex          lock;           // protects the queue list and sleeping
+	std::condition_variable wake;       // signalled when work is queued
+	std::vector<osd_work_queue *> queue;  // queues being served, highest priority first
+	std::vector<work_thread_info *> thread; // array of thread information
+	std::atomic<UINT32> sequence;       // bumped whenever work is queued
+	UINT32              rotate;         // round-robin start within a priority
+	int                 refcount;       // number of live queues
+	bool                exiting;        // should the threads exit?
+	int                 firstcpu;       // CPU the first thread is pinned to, or OSD_WORK_POLICY_AUTO
+	int                 classthreads[WORK_CLASS_COUNT]; // threads each class of queue may use at once
+	std::atomic<INT32>  classactive[WORK_CLASS_COUNT];  // threads working on each class of queue
+};
+
+
 struct osd_work_queue
 {
 	osd_work_queue()
@@ -140,11 +188,14 @@ struct osd_work_queue
 	, tailptr(nullptr)
 	, free(nullptr)
 	, items(0)
-	, livethreads(0)
+	, active(0)
 	, waiting(0)
 	, exiting(0)
 	, threads(0)
 	, flags(0)
+	, priority(0)
+	, workclass(WORK_CLASS_RENDER)
+	, caller(nullptr)
 	, doneevent(TRUE, TRUE)     // manual reset, signalled
 #if KEEP_STATISTICS
 	, itemsqueued(0)
@@ -160,12 +211,14 @@ struct osd_work_queue
 	osd_work_item ** volatile tailptr;  // pointer to the tail pointer of work items in the queue
 	std::atomic<osd_work_item *> free;  // free list of work items
 	std::atomic<INT32>  items;          // items in the queue
-	std::atomic<INT32>  livethreads;    // number of live threads
+	std::atomic<INT32>  active;         // number of pool threads working on the queue
 	std::atomic<INT32>  waiting;        // is someone waiting on the queue to complete?
-	std::atomic<INT32>  exiting;        // should the threads exit on their next opportunity?
-	UINT32              threads;        // number of threads in this queue
+	std::atomic<INT32>  exiting;        // is the queue being freed?
+	UINT32              threads;        // maximum number of pool threads working on the queue
 	UINT32              flags;          // creation flags
-	std::vector<work_thread_info *>  thread;         // array of thread information
+	int                 priority;       // pool priority, higher is served first
+	int                 workclass;      // thread budget class
+	work_thread_info *  caller;         // thread information for callers helping out
 	osd_event           doneevent;      // event signalled when work is complete
 
 #if KEEP_STATISTICS
@@ -207,14 +260,25 @@ struct osd_work_item
 
 int osd_num_processors = 0;
 
+static std::mutex s_pool_lock;          // protects creation and destruction of the pool
+static work_pool *s_pool = nullptr;     // the pool shared by all queues
+static osd_work_policy s_policy =       // limits applied when the pool is created
+{
+	OSD_WORK_POLICY_AUTO, OSD_WORK_POLICY_AUTO, OSD_WORK_POLICY_AUTO, OSD_WORK_POLICY_AUTO, OSD_WORK_POLICY_AUTO
+};
+
 //============================================================
 //  FUNCTION PROTOTYPES
 //============================================================
 
 static int effective_num_processors(void);
+static work_pool *work_pool_attach(osd_work_queue *queue);
+static void work_pool_detach(osd_work_queue *queue);
+static void work_pool_signal(work_pool *pool, int numitems);
+static osd_work_queue *work_pool_pick_queue(work_pool *pool);
+static void work_thread_set_affinity(int cpu);
 static void * worker_thread_entry(void *param);
-static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread);
-static bool queue_has_list_items(osd_work_queue *queue);
+static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread, int maxitems);
 
 //============================================================
 //  osd_thread_adjust_priority
@@ -244,6 +308,7 @@ int thread_adjust_priority(std::thread *thread, int adjust)
 	return TRUE;
 }
 
+
 //============================================================
 //  osd_work_queue_alloc
 //============================================================
@@ -254,7 +319,6 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	int numprocs = effective_num_processors();
 	osd_work_queue *queue;
 	int osdthreadnum = 0;
-	int allocthreadnum;
 	const char *osdworkqueuemaxthreads = osd_getenv(ENV_WORKQUEUEMAXTHREADS);
 
 	// allocate a new queue
@@ -264,61 +328,56 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	queue->tailptr = (osd_work_item **)&queue->list;
 	queue->flags = flags;
 
-	// determine how many threads to create...
-	// on a single-CPU system, create 1 thread for I/O queues, and 0 threads for everything else
+	// I/O queues are assumed to be blocked most of the time, so they are served first
+	if (flags & WORK_QUEUE_FLAG_IO)
+		queue->priority = 2;
+	else if (flags & WORK_QUEUE_FLAG_HIGH_FREQ)
+		queue->priority = 1;
+
+	if (flags & WORK_QUEUE_FLAG_IO)
+		queue->workclass = WORK_CLASS_IO;
+	else if (flags & WORK_QUEUE_FLAG_AUDIO)
+		queue->workclass = WORK_CLASS_AUDIO;
+
+	// determine how many pool threads may work on the queue...
+	// on a single-CPU system, 1 thread for I/O queues, and 0 threads for everything else
 	if (numprocs == 1)
 		threadnum = (flags & WORK_QUEUE_FLAG_IO) ? 1 : 0;
-	// on an n-CPU system, create n-1 threads for multi queues, and 1 thread for everything else
+	// on an n-CPU system, n-1 threads for multi queues, and 1 thread for everything else
 	else
 		threadnum = (flags & WORK_QUEUE_FLAG_MULTI) ? (numprocs - 1) : 1;
 
 	if (osdworkqueuemaxthreads != nullptr && sscanf(osdworkqueuemaxthreads, "%d", &osdthreadnum) == 1 && threadnum > osdthreadnum)
 		threadnum = osdthreadnum;
 
-	// clamp to the maximum
-	queue->threads = MIN(threadnum, WORK_MAX_THREADS);
+	// join the pool and clamp to the threads its class may use
+	work_pool *pool = work_pool_attach(queue);
+	queue->threads = MIN(threadnum, pool->classthreads[queue->workclass]);
 
-	// allocate memory for thread array (+1 to count the calling thread if WORK_QUEUE_FLAG_MULTI)
-	if (flags & WORK_QUEUE_FLAG_MULTI)
-		allocthreadnum = queue->threads + 1;
-	else
-		allocthreadnum = queue->threads;
+	// callers get the thread ID after the pool's (the only one when there are no threads)
+	queue->caller = new work_thread_info((queue->threads == 0) ? 0 : (UINT32)pool->thread.size(), nullptr);
 
 #if KEEP_STATISTICS
-	printf("osdprocs: %d effecprocs: %d threads: %d allocthreads: %d osdthreads: %d maxthreads: %d queuethreads: %d\n", osd_num_processors, numprocs, threadnum, allocthreadnum, osdthreadnum, WORK_MAX_THREADS, queue->threads);
+	printf("osdprocs: %d effecprocs: %d threads: %d osdthreads: %d maxthreads: %d queuethreads: %d poolthreads: %d\n", osd_num_processors, numprocs, threadnum, osdthreadnum, WORK_MAX_THREADS, queue->threads, (int)pool->thread.size());
 #endif
 
-	for (threadnum = 0; threadnum < allocthreadnum; threadnum++)
-		queue->thread.push_back(new work_thread_info(threadnum, *queue));
-
-	// iterate over threads
-	for (threadnum = 0; threadnum < queue->threads; threadnum++)
-	{
-		work_thread_info *thread = queue->thread[threadnum];
-
-		// create the thread
-		thread->handle = new std::thread(worker_thread_entry, thread);
-		if (thread->handle == nullptr)
-			goto error;
-
-		// set its priority: I/O threads get high priority because they are assumed to be
-		// blocked most of the time; other threads just match the creator's priority
-		if (flags & WORK_QUEUE_FLAG_IO)
-			thread_adjust_priority(thread->handle, 1);
-		else
-			thread_adjust_priority(thread->handle, 0);
-	}
-
 	// start a timer going for "waittime" on the main thread
 	if (flags & WORK_QUEUE_FLAG_MULTI)
 	{
-		begin_timing(queue->thread[queue->threads]->waittime);
+		begin_timing(queue->caller->waittime);
 	}
 	return queue;
+}
 
-error:
-	osd_work_queue_free(queue);
-	return nullptr;
+
+//============================================================
+//  osd_work_set_policy
+//============================================================
+
+void osd_work_set_policy(const osd_work_policy &policy)
+{
+	std::lock_guard<std::mutex> poollock(s_pool_lock);
+	s_policy = policy;
 }
 
 
@@ -350,12 +409,12 @@ int osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 	// if this is a multi queue, help out rather than doing nothing
 	if (queue->flags & WORK_QUEUE_FLAG_MULTI)
 	{
-		work_thread_info *thread = queue->thread[queue->threads];
+		work_thread_info *thread = queue->caller;
 
 		end_timing(thread->waittime);
 
 		// process what we can as a worker thread
-		worker_thread_process(queue, thread);
+		worker_thread_process(queue, thread, 0);
 
 		// if we're a high frequency queue, spin until done
 		if (queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue->items != 0)
@@ -392,38 +451,20 @@ void osd_work_queue_free(osd_work_queue *queue)
 	// stop the timer for "waittime" on the main thread
 	if (queue->flags & WORK_QUEUE_FLAG_MULTI)
 	{
-		end_timing(queue->thread[queue->threads]->waittime);
+		end_timing(queue->caller->waittime);
 	}
 
-	// signal all the threads to exit
+	// stop the pool from picking the queue, and wait for threads still on it;
+	// they give up on the queue after their current item
 	queue->exiting = TRUE;
-	for (int threadnum = 0; threadnum < queue->threads; threadnum++)
-	{
-		work_thread_info *thread = queue->thread[threadnum];
-		thread->wakeevent.set();
-	}
-
-	// wait for all the threads to go away
-	for (int threadnum = 0; threadnum < queue->threads; threadnum++)
-	{
-		work_thread_info *thread = queue->thread[threadnum];
-
-		// block on the thread going away, then close the handle
-		if (thread->handle != nullptr)
-		{
-			thread->handle->join();
-			delete thread->handle;
-		}
-
-	}
+	work_pool_detach(queue);
 
 #if KEEP_STATISTICS
-	// output per-thread statistics
-	for (work_thread_info *thread : queue->thread)
 	{
+		work_thread_info *thread = queue->caller;
 		osd_ticks_t total = thread->runtime + thread->waittime + thread->spintime;
-		printf("Thread %d:  items=%9d run=%5.2f%% (%5.2f%%)  spin=%5.2f%%  wait/other=%5.2f%% total=%9d\n",
-				thread->id, thread->itemsdone,
+		printf("Caller:  items=%9d run=%5.2f%% (%5.2f%%)  spin=%5.2f%%  wait/other=%5.2f%% total=%9d\n",
+				thread->itemsdone,
 				(double)thread->runtime * 100.0 / (double)total,
 				(double)thread->actruntime * 100.0 / (double)total,
 				(double)thread->spintime * 100.0 / (double)total,
@@ -432,10 +473,8 @@ void osd_work_queue_free(osd_work_queue *queue)
 	}
 #endif
 
-	// free the list
-	for (auto & th : queue->thread)
-		delete th;
-	queue->thread.clear();
+	delete queue->caller;
+	queue->caller = nullptr;
 
 	// free all items in the free list
 	while (queue->free.load() != nullptr)
@@ -520,6 +559,10 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 		parambase = (UINT8 *)parambase + paramstep;
 	}
 
+	// increment the number of items in the queue before anyone can complete them
+	queue->items += numitems;
+	add_to_stat(queue->itemsqueued, numitems);
+
 	// enqueue the whole thing within the critical section
 	{
 		std::lock_guard<std::mutex> lock(queue->lock);
@@ -527,40 +570,21 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 		queue->tailptr = item_tailptr;
 	}
 
-	// increment the number of items in the queue
-	queue->items += numitems;
-	add_to_stat(queue->itemsqueued, numitems);
-
-	// look for free threads to do the work
-	if (queue->livethreads < queue->threads)
+	// if no threads, run the queue now on this thread
+	if (queue->threads == 0)
 	{
-		int threadnum;
-
-		// iterate over all the threads
-		for (threadnum = 0; threadnum < queue->threads; threadnum++)
-		{
-			work_thread_info *thread = queue->thread[threadnum];
-
-			// if this thread is not active, wake him up
-			if (!thread->active)
-			{
-				thread->wakeevent.set();
-				add_to_stat(queue->setevents, 1);
-
-				// for non-shared, the first one we find is good enough
-				if (--numitems == 0)
-					break;
-			}
-		}
+		end_timing(queue->caller->waittime);
+		worker_thread_process(queue, queue->caller, 0);
+		begin_timing(queue->caller->waittime);
 	}
 
-	// if no threads, run the queue now on this thread
-	if (queue->threads == 0)
+	// otherwise let the pool know there is work
+	else
 	{
-		end_timing(queue->thread[0]->waittime);
-		worker_thread_process(queue, queue->thread[0]);
-		begin_timing(queue->thread[0]->waittime);
+		work_pool_signal(s_pool, numitems);
+		add_to_stat(queue->setevents, 1);
 	}
+
 	// only return the item if it won't get released automatically
 	return (flags & WORK_ITEM_FLAG_AUTO_RELEASE) ? nullptr : lastitem;
 }
@@ -661,61 +685,255 @@ static int effective_num_processors(void)
 }
 
 
+
+
+//============================================================
+//  work_pool_attach - add a queue to the shared
+//  pool, creating the pool for the first queue
+//============================================================
+
+static work_pool *work_pool_attach(osd_work_queue *queue)
+{
+	std::lock_guard<std::mutex> poollock(s_pool_lock);
+
+	if (s_pool == nullptr)
+	{
+		work_pool *pool = new work_pool();
+
+		// n-1 threads on an n-CPU system, since the main thread helps out; one for
+		// I/O on a single-CPU system; leave room for the callers' thread ID
+		int numprocs = effective_num_processors();
+		int threadnum = (numprocs == 1) ? 1 : (numprocs - 1);
+		int osdthreadnum = 0;
+		const char *osdworkqueuemaxthreads = osd_getenv(ENV_WORKQUEUEMAXTHREADS);
+		if (osdworkqueuemaxthreads != nullptr && sscanf(osdworkqueuemaxthreads, "%d", &osdthreadnum) == 1 && threadnum > osdthreadnum)
+			threadnum = MAX(osdthreadnum, 1);
+		if (s_policy.maxthreads != OSD_WORK_POLICY_AUTO)
+			threadnum = MIN(threadnum, MAX(s_policy.maxthreads, 0));
+		threadnum = MIN(threadnum, WORK_MAX_THREADS - 1);
+
+		// split the threads between the classes of queue
+		const int budget[WORK_CLASS_COUNT] = { s_policy.renderthreads, s_policy.audiothreads, s_policy.iothreads };
+		for (int index = 0; index < WORK_CLASS_COUNT; index++)
+			pool->classthreads[index] = (budget[index] == OSD_WORK_POLICY_AUTO) ? threadnum : MAX(MIN(budget[index], threadnum), 0);
+		pool->firstcpu = s_policy.firstcpu;
+
+		for (int index = 0; index < threadnum; index++)
+		{
+			work_thread_info *thread = new work_thread_info(index, pool);
+			pool->thread.push_back(thread);
+			thread->handle = new std::thread(worker_thread_entry, thread);
+		}
+		s_pool = pool;
+	}
+
+	// insert the queue after those of the same or higher priority
+	{
+		std::lock_guard<std::mutex> lock(s_pool->lock);
+		auto pos = s_pool->queue.begin();
+		while (pos != s_pool->queue.end() && (*pos)->priority >= queue->priority)
+			++pos;
+		s_pool->queue.insert(pos, queue);
+	}
+	s_pool->refcount++;
+	return s_pool;
+}
+
+
 //============================================================
-//  worker_thread_entry
+//  work_pool_detach - remove a queue from the
+//  pool, destroying the pool after the last one
 //============================================================
 
-static void *worker_thread_entry(void *param)
+static void work_pool_detach(osd_work_queue *queue)
 {
-	work_thread_info *thread = (work_thread_info *)param;
-	osd_work_queue &queue = thread->queue;
+	// the queue still holds a reference, so the pool can't go away under us
+	work_pool *pool = s_pool;
 
-	// loop until we exit
-	for ( ;; )
+	// once it is off the list, no thread picks the queue again
+	{
+		std::lock_guard<std::mutex> lock(pool->lock);
+		for (auto pos = pool->queue.begin(); pos != pool->queue.end(); ++pos)
+			if (*pos == queue)
+			{
+				pool->queue.erase(pos);
+				break;
+			}
+	}
+
+	// let the threads already on it finish their batch; this is done without
+	// the pool lock so other queues can still be created and freed meanwhile
+	while (queue->active != 0)
+		std::this_thread::yield();
+
+	std::lock_guard<std::mutex> poollock(s_pool_lock);
+	if (--pool->refcount != 0)
+		return;
+
+	// last queue gone: signal all the threads to exit and wait for them
+	{
+		std::lock_guard<std::mutex> lock(pool->lock);
+		pool->exiting = true;
+	}
+	pool->wake.notify_all();
+
+	for (work_thread_info *thread : pool->thread)
+	{
+		thread->handle->join();
+		delete thread->handle;
+
+#if KEEP_STATISTICS
+		osd_ticks_t total = thread->runtime + thread->waittime + thread->spintime;
+		printf("Thread %d:  items=%9d run=%5.2f%% (%5.2f%%)  spin=%5.2f%%  wait/other=%5.2f%% total=%9d\n",
+				thread->id, thread->itemsdone,
+				(double)thread->runtime * 100.0 / (double)total,
+				(double)thread->actruntime * 100.0 / (double)total,
+				(double)thread->spintime * 100.0 / (double)total,
+				(double)thread->waittime * 100.0 / (double)total,
+				(UINT32) total);
+#endif
+		delete thread;
+	}
+
+	delete pool;
+	s_pool = nullptr;
+}
+
+
+//============================================================
+//  work_pool_signal - wake pool threads after
+//  work has been queued
+//============================================================
+
+static void work_pool_signal(work_pool *pool, int numitems)
+{
+	pool->sequence++;
+
+	// threads decide to sleep while holding the lock, so taking it here
+	// guarantees they either see the new work or get the notification
 	{
-		// block waiting for work or exit
-		// bail on exit, and only wait if there are no pending items in queue
-		if (queue.exiting)
-			break;
+		std::lock_guard<std::mutex> lock(pool->lock);
+	}
+
+	// wake a thread per item; any more would only find the queue empty
+	if (numitems >= (int)pool->thread.size())
+		pool->wake.notify_all();
+	else
+		for (int index = 0; index < numitems; index++)
+			pool->wake.notify_one();
+}
+
+
+//============================================================
+//  work_pool_pick_queue - choose the next queue
+//  for a pool thread; called with the pool lock
+//  held
+//============================================================
+
+static osd_work_queue *work_pool_pick_queue(work_pool *pool)
+{
+	int count = pool->queue.size();
 
-		if (!queue_has_list_items(&queue))
+	// queues are sorted by priority; within a priority, rotate the starting
+	// point so that a busy queue can't starve the others
+	for (int first = 0; first < count; )
+	{
+		int last = first + 1;
+		while (last < count && pool->queue[last]->priority == pool->queue[first]->priority)
+			last++;
+
+		for (int index = 0; index < last - first; index++)
 		{
-			begin_timing(thread->waittime);
-			thread->wakeevent.wait( OSD_EVENT_WAIT_INFINITE);
-			end_timing(thread->waittime);
+			osd_work_queue *queue = pool->queue[first + (pool->rotate + index) % (last - first)];
+			if (queue->list.load() != nullptr && queue->active < (INT32)queue->threads && pool->classactive[queue->workclass] < pool->classthreads[queue->workclass])
+			{
+				pool->rotate++;
+				queue->active++;
+				pool->classactive[queue->workclass]++;
+				return queue;
+			}
 		}
+		first = last;
+	}
+	return nullptr;
+}
+
+
+//============================================================
+//  work_thread_set_affinity - pin the calling
+//  thread to a CPU, where the platform allows it
+//============================================================
+
+static void work_thread_set_affinity(int cpu)
+{
+#if defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+	if (cpu < 8 * (int)sizeof(DWORD_PTR))
+		SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu);
+#elif defined(__linux__)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	sched_setaffinity(0, sizeof(set), &set);
+#else
+	(void)cpu;
+#endif
+}
 
-		if (queue.exiting)
-			break;
 
-		// indicate that we are live
-		thread->active = TRUE;
-		++queue.livethreads;
+//============================================================
+//  worker_thread_entry
+//============================================================
+
+static void *worker_thread_entry(void *param)
+{
+	work_thread_info *thread = (work_thread_info *)param;
+	work_pool &pool = *thread->pool;
+	bool spin = false;
 
-		// process work items
-		for ( ;; )
+	// pin to a CPU if asked to, wrapping around the ones present
+	if (pool.firstcpu != OSD_WORK_POLICY_AUTO)
+		work_thread_set_affinity((pool.firstcpu + thread->id) % MAX(std::thread::hardware_concurrency(), 1U));
+
+	// loop until we exit
+	for ( ;; )
+	{
+		osd_work_queue *queue;
+		UINT32 sequence;
 		{
-			// process as much as we can
-			worker_thread_process(&queue, thread);
+			std::unique_lock<std::mutex> lock(pool.lock);
+			sequence = pool.sequence;
+			queue = work_pool_pick_queue(&pool);
 
-			// if we're a high frequency queue, spin for a while before giving up
-			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue.list.load() == nullptr)
+			// block waiting for work or exit, unless we want to spin first
+			if (queue == nullptr)
 			{
-				// spin for a while looking for more work
-				begin_timing(thread->spintime);
-				spin_while<std::atomic<osd_work_item *>, osd_work_item *>(&queue.list, (osd_work_item *)nullptr, SPIN_LOOP_TIME);
-				end_timing(thread->spintime);
+				if (pool.exiting)
+					break;
+				if (!spin)
+				{
+					begin_timing(thread->waittime);
+					pool.wake.wait(lock);
+					end_timing(thread->waittime);
+					continue;
+				}
 			}
+		}
 
-			// if nothing more, release the processor
-			if (!queue_has_list_items(&queue))
-				break;
-			add_to_stat(queue.spinloops, 1);
+		// after working on a high frequency queue, spin for a while looking for more work
+		if (queue == nullptr)
+		{
+			begin_timing(thread->spintime);
+			spin_while<std::atomic<UINT32>, UINT32>(&pool.sequence, sequence, SPIN_LOOP_TIME);
+			end_timing(thread->spintime);
+			spin = false;
+			continue;
 		}
 
-		// decrement the live thread count
-		thread->active = FALSE;
-		--queue.livethreads;
+		// process a batch of items, then pick again so other queues get a turn
+		worker_thread_process(queue, thread, WORK_POOL_BATCH_ITEMS);
+		spin = (queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ) != 0;
+		--pool.classactive[queue->workclass];
+		--queue->active;
 	}
 
 	return nullptr;
@@ -726,91 +944,66 @@ static void *worker_thread_entry(void *param)
 //  worker_thread_process
 //============================================================
 
-static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread)
+static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread, int maxitems)
 {
 	int threadid = thread->id;
+	int itemsdone = 0;
 
 	begin_timing(thread->runtime);
 
-	// loop until everything is processed
-	while (true)
+	// loop until everything is processed, the batch is done, or the queue is going away
+	while (!queue->exiting && (maxitems == 0 || itemsdone < maxitems))
 	{
-		osd_work_item *item = nullptr;
-
-		bool end_loop = false;
+		osd_work_item *item;
 
 		// use a critical section to synchronize the removal of items
 		{
 			std::lock_guard<std::mutex> lock(queue->lock);
 
+			// pull the item from the queue
+			item = (osd_work_item *)queue->list;
+			if (item == nullptr)
+				break;
+			queue->list = item->next;
 			if (queue->list.load() == nullptr)
-			{
-				end_loop = true;
-			}
-			else
-			{
-				// pull the item from the queue
-				item = (osd_work_item *)queue->list;
-				if (item != nullptr)
-				{
-					queue->list = item->next;
-					if (queue->list.load() == nullptr)
-						queue->tailptr = (osd_work_item **)&queue->list;
-				}
-			}
+				queue->tailptr = (osd_work_item **)&queue->list;
 		}
 
-		if (end_loop)
-			break;
+		// call the callback and stash the result
+		begin_timing(thread->actruntime);
+		item->result = (*item->callback)(item->param, threadid);
+		end_timing(thread->actruntime);
+		itemsdone++;
 
-		// process non-NULL items
-		if (item != nullptr)
+		// mark the item done; if it's an auto-release item, release it
+		item->done = TRUE;
+		add_to_stat(thread->itemsdone, 1);
+		if (item->flags & WORK_ITEM_FLAG_AUTO_RELEASE)
+			osd_work_item_release(item);
+
+		// set the result and signal the event
+		else
 		{
-			// call the callback and stash the result
-			begin_timing(thread->actruntime);
-			item->result = (*item->callback)(item->param, threadid);
-			end_timing(thread->actruntime);
-
-			// decrement the item count after we are done
-			--queue->items;
-			item->done = TRUE;
-			add_to_stat(thread->itemsdone, 1);
-
-			// if it's an auto-release item, release it
-			if (item->flags & WORK_ITEM_FLAG_AUTO_RELEASE)
-				osd_work_item_release(item);
-
-			// set the result and signal the event
-			else
-			{
-				std::lock_guard<std::mutex> lock(queue->lock);
+			std::lock_guard<std::mutex> lock(queue->lock);
 
-				if (item->event != nullptr)
-				{
-					item->event->set();
-					add_to_stat(item->queue.setevents, 1);
-				}
+			if (item->event != nullptr)
+			{
+				item->event->set();
+				add_to_stat(item->queue.setevents, 1);
 			}
+		}
 
-			// if we removed an item and there's still work to do, bump the stats
-			if (queue_has_list_items(queue))
-				add_to_stat(queue->extraitems, 1);
+		// decrement the item count after we are done; wake a waiter on the last one
+		if (--queue->items == 0 && queue->waiting)
+		{
+			queue->doneevent.set();
+			add_to_stat(queue->setevents, 1);
 		}
-	}
 
-	// we don't need to set the doneevent for multi queues because they spin
-	if (queue->waiting)
-	{
-		queue->doneevent.set();
-		add_to_stat(queue->setevents, 1);
+		// if we removed an item and there's still work to do, bump the stats
+		if (queue->list.load() != nullptr)
+			add_to_stat(queue->extraitems, 1);
 	}
 
 	end_timing(thread->runtime);
 }
-
-bool queue_has_list_items(osd_work_queue *queue)
-{
-	std::lock_guard<std::mutex> lock(queue->lock);
-	bool has_list_items = (queue->list.load() != nullptr);
-	return has_list_items;
-}
@@ -163,4 +163,43 @@ private:
 
 };
 
+/***************************************************************************
+    WORK QUEUE THREADING POLICY
+***************************************************************************/
+
+/* use the default for a policy field */
+#define OSD_WORK_POLICY_AUTO    (-1)
+
+/* limits on the worker threads shared by all work queues; every field may
+   be OSD_WORK_POLICY_AUTO */
+struct osd_work_policy
+{
+	int     maxthreads;     /* total worker threads, not counting the threads queueing work */
+	int     firstcpu;       /* pin worker n to CPU firstcpu + n; AUTO leaves them to the scheduler */
+	int     renderthreads;  /* workers serving queues without the AUDIO or IO flag at once */
+	int     audiothreads;   /* workers serving WORK_QUEUE_FLAG_AUDIO queues at once */
+	int     iothreads;      /* workers serving WORK_QUEUE_FLAG_IO queues at once */
+};
+
+/*-----------------------------------------------------------------------------
+    osd_work_set_policy: limit the worker threads used by work queues
+
+    Parameters:
+
+        policy - the limits to apply
+
+    Return value:
+
+        None
+
+    Notes:
+
+        The worker threads are created with the first work queue and live
+        until the last one is freed, so a new policy takes effect the next
+        time they are created, normally when the next machine starts. A
+        subsystem budget of 0 makes its queues run their items on the
+        thread that waits for them.
+-----------------------------------------------------------------------------*/
+void osd_work_set_policy(const osd_work_policy &policy);
+
 #endif  /* __OSDSYNC__ */
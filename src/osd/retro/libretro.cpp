@@ -3,6 +3,7 @@
 #include <string.h>
 
 #include "osdepend.h"
+#include "osdsync.h"
 
 #include "../frontend/mame/mame.h"
 #include "emu.h"
@@ -54,6 +55,11 @@ static char option_auto_save[50];
 static char option_throttle[50];
 static char option_nobuffer[50];
 static char option_saves[50];
+static char option_threads[50];
+static char option_affinity[50];
+static char option_render_threads[50];
+static char option_audio_threads[50];
+static char option_io_threads[50];
 
 static int cpu_overclock = 100;
 
@@ -152,6 +158,11 @@ void retro_set_environment(retro_environment_t cb)
    sprintf(option_saves,"%s_%s",core,"saves");
    sprintf(option_throttle,"%s_%s",core,"throttle");
   sprintf(option_nobuffer,"%s_%s",core,"nobuffer");
+   sprintf(option_threads,"%s_%s",core,"worker_threads");
+   sprintf(option_affinity,"%s_%s",core,"worker_affinity");
+   sprintf(option_render_threads,"%s_%s",core,"render_threads");
+   sprintf(option_audio_threads,"%s_%s",core,"audio_threads");
+   sprintf(option_io_threads,"%s_%s",core,"io_threads");
 
    static const struct retro_variable vars[] = {
     /* some ifdefs are redundant but I wanted 
@@ -175,6 +186,13 @@ void retro_set_environment(retro_environment_t cb)
 
     { option_osd, "Boot to OSD; disabled|enabled" },
     { option_cli, "Boot from CLI; disabled|enabled" },
+
+    /* worker thread limits, applied when the next game starts */
+    { option_threads, "Worker threads (applies at next game start); auto|0|1|2|3|4|5|6|7|8|9|10|11|12|13|14|15" },
+    { option_affinity, "Pin worker threads from CPU (applies at next game start); disabled|0|1|2|3|4|5|6|7|8|9|10|11|12|13|14|15|16|17|18|19|20|21|22|23|24|25|26|27|28|29|30|31" },
+    { option_render_threads, "Video worker threads (applies at next game start); auto|0|1|2|3|4|5|6|7|8" },
+    { option_audio_threads, "Audio worker threads (applies at next game start); auto|0|1|2|3|4" },
+    { option_io_threads, "I/O worker threads (applies at next game start); auto|0|1|2" },
     { NULL, NULL },
 
    };
@@ -192,9 +210,26 @@ static void update_runtime_variables(void)
     mame_machine_manager::instance()->machine()->firstcpu->set_clock_scale((float)cpu_overclock * 0.01f);
 }
 
+/* "auto" or "disabled" leave a worker thread limit to the OSD */
+static int thread_policy_value(const char *key)
+{
+   struct retro_variable var = {0};
+
+   var.key   = key;
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if (strcmp(var.value, "auto") && strcmp(var.value, "disabled"))
+         return atoi(var.value);
+   }
+   return OSD_WORK_POLICY_AUTO;
+}
+
 static void check_variables(void)
 {
    struct retro_variable var = {0};
+   osd_work_policy policy;
 
    var.key   = option_cli;
    var.value = NULL;
@@ -400,6 +435,13 @@ static void check_variables(void)
       if (!strcmp(var.value, "enabled"))
          write_config_enable = true;
    }
+
+   policy.maxthreads    = thread_policy_value(option_threads);
+   policy.firstcpu      = thread_policy_value(option_affinity);
+   policy.renderthreads = thread_policy_value(option_render_threads);
+   policy.audiothreads  = thread_policy_value(option_audio_threads);
+   policy.iothreads     = thread_policy_value(option_io_threads);
+   osd_work_set_policy(policy);
 }
 
 unsigned retro_api_version(void)
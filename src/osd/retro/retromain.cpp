@@ -48,6 +48,9 @@ public:
 
 private:
 	virtual void osd_exit();
+
+	// what is already in the frame buffer
+	render_dirty_tracker m_dirty_tracker;
 };
 
 /* Args for experimental_commandline */
@@ -1886,10 +1889,20 @@ void retro_osd_interface::update(bool skip_redraw)
       gl_draw_primitives(primlist, fb_width, fb_height);
 #else
       UINT8 *surfptr = (UINT8 *)retro_get_fb_ptr();
+
+      /* the frame buffer keeps the last frame, so only redraw the rows that changed */
+      INT32 miny, maxy;
+      if (!m_dirty_tracker.update(primlist, minwidth, minheight, miny, maxy))
+      {
+         miny = 0;
+         maxy = minheight - 1;
+      }
+
+      if (miny <= maxy)
 #ifdef M16B
-      software_renderer<UINT16, 3,2,3, 11,5,0>::draw_primitives(primlist, surfptr, minwidth, minheight,minwidth );
+         software_renderer<UINT16, 3,2,3, 11,5,0>::draw_primitives(primlist, surfptr, minwidth, minheight,minwidth, miny, maxy);
 #else
-      software_renderer<UINT32, 0,0,0, 16,8,0>::draw_primitives(primlist, surfptr, minwidth, minheight,minwidth );
+         software_renderer<UINT32, 0,0,0, 16,8,0>::draw_primitives(primlist, surfptr, minwidth, minheight,minwidth, miny, maxy);
 #endif
 
 #endif
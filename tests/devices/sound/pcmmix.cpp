@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+#include "emucore.h"
+#include "sound/pcmmix.h"
+
+#include <random>
+
+// random 16-bit voice blocks and gains of either sign, mixed at every
+// block length and output offset into a buffer that already holds samples
+
+TEST(pcmmix,constant_gain)
+{
+	std::mt19937 rand(1);
+	for (int iter = 0; iter < 2000; iter++)
+	{
+		INT32 in[PCMMIX_BLOCK_SAMPLES], block[PCMMIX_BLOCK_SAMPLES + 3], serial[PCMMIX_BLOCK_SAMPLES + 3];
+		for (INT32 &sample : in)
+			sample = int(rand() % 0x10000) - 0x8000;
+		for (int i = 0; i < PCMMIX_BLOCK_SAMPLES + 3; i++)
+			block[i] = serial[i] = int(rand() % 0x100000) - 0x80000;
+		const INT32 gain = int(rand() % 0x10000) - 0x8000;
+		const int shift = rand() % 16;
+		const int offset = rand() % 4;
+		const int count = rand() % (PCMMIX_BLOCK_SAMPLES + 1);
+
+		pcm_mix_block(block + offset, in, gain, shift, count);
+		for (int i = 0; i < count; i++)
+			serial[offset + i] += (in[i] * gain) >> shift;
+		for (int i = 0; i < PCMMIX_BLOCK_SAMPLES + 3; i++)
+			ASSERT_EQ(serial[i], block[i]) << "iteration " << iter << ", sample " << i;
+	}
+}
+
+TEST(pcmmix,sample_gain)
+{
+	std::mt19937 rand(2);
+	for (int iter = 0; iter < 2000; iter++)
+	{
+		INT32 in[PCMMIX_BLOCK_SAMPLES], gain[PCMMIX_BLOCK_SAMPLES], block[PCMMIX_BLOCK_SAMPLES + 3], serial[PCMMIX_BLOCK_SAMPLES + 3];
+		for (int i = 0; i < PCMMIX_BLOCK_SAMPLES; i++)
+		{
+			in[i] = int(rand() % 0x10000) - 0x8000;
+			gain[i] = int(rand() % 0x10000) - 0x8000;
+		}
+		for (int i = 0; i < PCMMIX_BLOCK_SAMPLES + 3; i++)
+			block[i] = serial[i] = int(rand() % 0x100000) - 0x80000;
+		const int shift = rand() % 16;
+		const int offset = rand() % 4;
+		const int count = rand() % (PCMMIX_BLOCK_SAMPLES + 1);
+
+		pcm_mix_block(block + offset, in, gain, shift, count);
+		for (int i = 0; i < count; i++)
+			serial[offset + i] += (in[i] * gain[i]) >> shift;
+		for (int i = 0; i < PCMMIX_BLOCK_SAMPLES + 3; i++)
+			ASSERT_EQ(serial[i], block[i]) << "iteration " << iter << ", sample " << i;
+	}
+}
+
+TEST(pcmmix,double_gain)
+{
+	std::mt19937 rand(3);
+	for (int iter = 0; iter < 2000; iter++)
+	{
+		INT32 in[PCMMIX_BLOCK_SAMPLES];
+		double block[PCMMIX_BLOCK_SAMPLES + 1], serial[PCMMIX_BLOCK_SAMPLES + 1];
+		for (INT32 &sample : in)
+			sample = int(rand() % 0x10000) - 0x8000;
+		for (int i = 0; i < PCMMIX_BLOCK_SAMPLES + 1; i++)
+			block[i] = serial[i] = (int(rand() % 0x100000) - 0x80000) / 7.0;
+		const double gain = (int(rand() % 0x10000) - 0x8000) / 3000.0;
+		const int offset = rand() % 2;
+		const int count = rand() % (PCMMIX_BLOCK_SAMPLES + 1);
+
+		pcm_mix_block(block + offset, in, gain, count);
+		for (int i = 0; i < count; i++)
+			serial[offset + i] += in[i] * gain;
+		for (int i = 0; i < PCMMIX_BLOCK_SAMPLES + 1; i++)
+			ASSERT_EQ(serial[i], block[i]) << "iteration " << iter << ", sample " << i;
+	}
+}
@@ -0,0 +1,46 @@
+#include "gtest/gtest.h"
+#include "emucore.h"
+#include "sound/ym2151mix.h"
+
+#include <random>
+
+// random channel outputs, loud enough to clip, mixed with random panning
+// by the batch mixer and by the one-sample-at-a-time loop, for every batch
+// length up to the 32 samples ym2151_update_one() generates at once
+TEST(ym2151mix,batch_matches_scalar)
+{
+	const int stride = 32;
+	std::mt19937 rand(1);
+
+	for (int iter = 0; iter < 1000; iter++)
+	{
+		INT32 chanout[8 * stride];
+		UINT32 pan[16];
+		for (INT32 &out : chanout)
+			out = int(rand() % 0x10000) - 0x8000;
+		for (UINT32 &mask : pan)
+			mask = (rand() & 1) ? ~0 : 0;
+
+		for (int length = 0; length <= stride; length++)
+		{
+			INT32 batchL[stride] = { 0 }, batchR[stride] = { 0 };
+			INT32 scalarL[stride] = { 0 }, scalarR[stride] = { 0 };
+
+			ym2151_mix<0, -32768, 32767>(chanout, stride, pan, batchL, batchR, length);
+			ym2151_mix_scalar<0, -32768, 32767>(chanout, stride, pan, scalarL, scalarR, 0, length);
+			for (int s = 0; s < stride; s++)
+			{
+				ASSERT_EQ(scalarL[s], batchL[s]) << "iteration " << iter << ", length " << length << ", sample " << s;
+				ASSERT_EQ(scalarR[s], batchR[s]) << "iteration " << iter << ", length " << length << ", sample " << s;
+			}
+
+			ym2151_mix<8, -128, 127>(chanout, stride, pan, batchL, batchR, length);
+			ym2151_mix_scalar<8, -128, 127>(chanout, stride, pan, scalarL, scalarR, 0, length);
+			for (int s = 0; s < stride; s++)
+			{
+				ASSERT_EQ(scalarL[s], batchL[s]) << "iteration " << iter << ", length " << length << ", sample " << s;
+				ASSERT_EQ(scalarR[s], batchR[s]) << "iteration " << iter << ", length " << length << ", sample " << s;
+			}
+		}
+	}
+}
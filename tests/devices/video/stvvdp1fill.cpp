@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include "emucore.h"
+#include "bitmap.h"
+#include "video/stvvdp1fill.h"
+
+#include <random>
+
+// random quads, some reaching past the framebuffer and some ending right
+// on the first line of a band, drawn once over the whole framebuffer and
+// once in bands of 32 lines the way stv_vdp1_draw_list splits them
+TEST(stvvdp1fill,banded_matches_serial)
+{
+	const int width = 512, height = 256, bandlines = 32;
+	const rectangle clip(0, width - 1, 0, height - 1);
+	std::vector<UINT32> serial(width * height), banded(width * height);
+	std::mt19937 rand(1);
+
+	for (UINT32 quad = 1; quad <= 2000; quad++)
+	{
+		struct spoint q[4];
+		for (struct spoint &p : q)
+		{
+			p.x = int(rand() % (width + 64)) - 32;
+			p.y = int(rand() % (height + 64)) - 32;
+			p.u = rand() % 64;
+			p.v = rand() % 64;
+		}
+		if (quad % 4 == 0)
+		{
+			int bottom = (1 + rand() % (height / bandlines - 1)) * bandlines;
+			for (struct spoint &p : q)
+				p.y = bottom - int(rand() % 40);
+			q[rand() % 4].y = bottom;
+		}
+
+		vdp1_fill_quad(clip, 0, 64, q, [&serial, quad](int x, int y, int, int offsetcnt) {
+			serial[y * width + x] = (quad << 16) | (offsetcnt & 0xffff);
+		});
+		for (int band_y = 0; band_y < height; band_y += bandlines)
+		{
+			const rectangle band(clip.min_x, clip.max_x, band_y, band_y + bandlines - 1);
+			vdp1_fill_quad(band, 0, 64, q, [&banded, quad](int x, int y, int, int offsetcnt) {
+				banded[y * width + x] = (quad << 16) | (offsetcnt & 0xffff);
+			});
+		}
+
+		ASSERT_TRUE(serial == banded) << "quad " << quad
+				<< " (" << q[0].x << "," << q[0].y << ") (" << q[1].x << "," << q[1].y
+				<< ") (" << q[2].x << "," << q[2].y << ") (" << q[3].x << "," << q[3].y << ")";
+	}
+}
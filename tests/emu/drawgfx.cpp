@@ -0,0 +1,177 @@
+#include "gtest/gtest.h"
+#include "emucore.h"
+#include "bitmap.h"
+#include "drawgfxm.h"
+
+#include <random>
+
+TEST(drawgfx,row_ops)
+{
+	std::mt19937 rand;
+	UINT8 srcrow[64];
+	const UINT8 *src;
+	UINT32 count;
+	int xdir;
+	UINT16 dest16[64], refdest16[64];
+	UINT32 dest32[64], refdest32[64];
+	UINT8 pri[64], refpri[64];
+	pen_t paldata[256];
+	UINT32 color, trans_pen, pmask, usage;
+
+	// draw random rows with the row op, falling back to the pixel op where
+	// it isn't taken, and again with the pixel op alone into the ref buffers
+	auto check = [&](unsigned seed, auto draw, auto reference)
+	{
+		rand.seed(seed);
+		for (int iter = 0; iter < 20000; iter++)
+		{
+			count = 1 + rand() % 48;
+			xdir = (rand() & 1) ? 1 : -1;
+			for (int i = 0; i < 64; i++)
+			{
+				// few distinct pens so transparent runs show up
+				srcrow[i] = (rand() & 3) ? (rand() & 3) : (rand() & 0xff);
+				dest32[i] = refdest32[i] = rand();
+				dest16[i] = refdest16[i] = dest32[i];
+				pri[i] = refpri[i] = (rand() & 1) ? 31 : (rand() & 0xff);
+			}
+			for (int i = 0; i < 256; i++)
+				paldata[i] = rand();
+			src = (xdir > 0) ? srcrow : srcrow + count - 1;
+			color = rand() & 0xffff;
+			trans_pen = rand() & 3;
+
+			// pen usage: unknown, or exact for pens below 32, optionally
+			// with rows made all transparent or free of transparency
+			usage = ~0;
+			const int mode = rand() & 3;
+			if (mode != 0)
+			{
+				usage = 0;
+				for (UINT32 i = 0; i < count; i++)
+				{
+					if (mode == 2)
+						srcrow[i] = trans_pen;
+					else if (mode == 3 && srcrow[i] == trans_pen)
+						srcrow[i] = trans_pen ^ 1;
+					srcrow[i] &= 0x1f;
+					usage |= 1 << srcrow[i];
+				}
+			}
+			pmask = (rand() & 3) ? (rand() | (1 << 31)) : (1 << 31);
+
+			draw();
+			reference();
+			ASSERT_TRUE(memcmp(dest16, refdest16, sizeof(dest16)) == 0 && memcmp(dest32, refdest32, sizeof(dest32)) == 0
+					&& memcmp(pri, refpri, sizeof(pri)) == 0) << "seed " << seed << ", iteration " << iter;
+		}
+	};
+
+	check(1, [&]
+		{
+			if (!ROW_OP_REBASE_OPAQUE(dest16, (NO_PRIORITY *)nullptr, src, count, xdir, usage))
+				for (UINT32 x = 0; x < count; x++)
+					PIXEL_OP_REBASE_OPAQUE(dest16[x], pri[x], src[xdir * (INT32)x]);
+		},
+		[&]
+		{
+			for (UINT32 x = 0; x < count; x++)
+				PIXEL_OP_REBASE_OPAQUE(refdest16[x], refpri[x], src[xdir * (INT32)x]);
+		});
+
+	check(2, [&]
+		{
+			if (!ROW_OP_REBASE_OPAQUE_PRIORITY(dest16, pri, src, count, xdir, usage))
+				for (UINT32 x = 0; x < count; x++)
+					PIXEL_OP_REBASE_OPAQUE_PRIORITY(dest16[x], pri[x], src[xdir * (INT32)x]);
+		},
+		[&]
+		{
+			for (UINT32 x = 0; x < count; x++)
+				PIXEL_OP_REBASE_OPAQUE_PRIORITY(refdest16[x], refpri[x], src[xdir * (INT32)x]);
+		});
+
+	check(3, [&]
+		{
+			if (!ROW_OP_REBASE_TRANSPEN(dest16, (NO_PRIORITY *)nullptr, src, count, xdir, usage))
+				for (UINT32 x = 0; x < count; x++)
+					PIXEL_OP_REBASE_TRANSPEN(dest16[x], pri[x], src[xdir * (INT32)x]);
+		},
+		[&]
+		{
+			for (UINT32 x = 0; x < count; x++)
+				PIXEL_OP_REBASE_TRANSPEN(refdest16[x], refpri[x], src[xdir * (INT32)x]);
+		});
+
+	check(4, [&]
+		{
+			if (!ROW_OP_REBASE_TRANSPEN_PRIORITY(dest16, pri, src, count, xdir, usage))
+				for (UINT32 x = 0; x < count; x++)
+					PIXEL_OP_REBASE_TRANSPEN_PRIORITY(dest16[x], pri[x], src[xdir * (INT32)x]);
+		},
+		[&]
+		{
+			for (UINT32 x = 0; x < count; x++)
+				PIXEL_OP_REBASE_TRANSPEN_PRIORITY(refdest16[x], refpri[x], src[xdir * (INT32)x]);
+		});
+
+	check(5, [&]
+		{
+			if (!ROW_OP_REBASE_TRANSPEN(dest32, (NO_PRIORITY *)nullptr, src, count, xdir, usage))
+				for (UINT32 x = 0; x < count; x++)
+					PIXEL_OP_REBASE_TRANSPEN(dest32[x], pri[x], src[xdir * (INT32)x]);
+		},
+		[&]
+		{
+			for (UINT32 x = 0; x < count; x++)
+				PIXEL_OP_REBASE_TRANSPEN(refdest32[x], refpri[x], src[xdir * (INT32)x]);
+		});
+
+	check(6, [&]
+		{
+			if (!ROW_OP_REBASE_TRANSPEN_PRIORITY(dest32, pri, src, count, xdir, usage))
+				for (UINT32 x = 0; x < count; x++)
+					PIXEL_OP_REBASE_TRANSPEN_PRIORITY(dest32[x], pri[x], src[xdir * (INT32)x]);
+		},
+		[&]
+		{
+			for (UINT32 x = 0; x < count; x++)
+				PIXEL_OP_REBASE_TRANSPEN_PRIORITY(refdest32[x], refpri[x], src[xdir * (INT32)x]);
+		});
+
+	check(7, [&]
+		{
+			if (!ROW_OP_REMAP_OPAQUE_PRIORITY(dest32, pri, src, count, xdir, usage))
+				for (UINT32 x = 0; x < count; x++)
+					PIXEL_OP_REMAP_OPAQUE_PRIORITY(dest32[x], pri[x], src[xdir * (INT32)x]);
+		},
+		[&]
+		{
+			for (UINT32 x = 0; x < count; x++)
+				PIXEL_OP_REMAP_OPAQUE_PRIORITY(refdest32[x], refpri[x], src[xdir * (INT32)x]);
+		});
+
+	check(8, [&]
+		{
+			if (!ROW_OP_REMAP_TRANSPEN(dest32, (NO_PRIORITY *)nullptr, src, count, xdir, usage))
+				for (UINT32 x = 0; x < count; x++)
+					PIXEL_OP_REMAP_TRANSPEN(dest32[x], pri[x], src[xdir * (INT32)x]);
+		},
+		[&]
+		{
+			for (UINT32 x = 0; x < count; x++)
+				PIXEL_OP_REMAP_TRANSPEN(refdest32[x], refpri[x], src[xdir * (INT32)x]);
+		});
+
+	check(9, [&]
+		{
+			if (!ROW_OP_REMAP_TRANSPEN_PRIORITY(dest32, pri, src, count, xdir, usage))
+				for (UINT32 x = 0; x < count; x++)
+					PIXEL_OP_REMAP_TRANSPEN_PRIORITY(dest32[x], pri[x], src[xdir * (INT32)x]);
+		},
+		[&]
+		{
+			for (UINT32 x = 0; x < count; x++)
+				PIXEL_OP_REMAP_TRANSPEN_PRIORITY(refdest32[x], refpri[x], src[xdir * (INT32)x]);
+		});
+}
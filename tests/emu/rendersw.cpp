@@ -0,0 +1,136 @@
+#include "gtest/gtest.h"
+#include "emu.h"
+#include "rendutil.h"
+#include "rendersw.hxx"
+
+#include <random>
+
+TEST(rendersw,dirty_band_point)
+{
+	typedef software_renderer<UINT32, 0,0,0, 16,8,0, false, false> renderer;
+	const UINT32 texwidth = 64, texheight = 48, width = 160, height = 123;
+
+	// a screen-sized RGB32 texture scaled onto a target that isn't a whole
+	// multiple of it, with a band of rows changed between two frames
+	for (bool flipped : { false, true })
+	{
+		std::mt19937 rand(1 + flipped);
+		std::vector<UINT32> texture(texwidth * texheight);
+		std::vector<UINT32> before(width * height), full(width * height), partial(width * height);
+		render_primitive prim;
+
+		for (UINT32 &texel : texture)
+			texel = rand() & 0xffffff;
+
+		prim.type = render_primitive::QUAD;
+		prim.flags = PRIMFLAG_TEXFORMAT(TEXFORMAT_RGB32) | PRIMFLAG_BLENDMODE(BLENDMODE_NONE);
+		set_render_bounds_xy(&prim.bounds, 0.0f, 0.0f, float(width), float(height));
+		set_render_color(&prim.color, 1.0f, 1.0f, 1.0f, 1.0f);
+		prim.texcoords.tl.u = prim.texcoords.bl.u = 0.0f;
+		prim.texcoords.tr.u = prim.texcoords.br.u = 1.0f;
+		prim.texcoords.tl.v = prim.texcoords.tr.v = flipped ? 1.0f : 0.0f;
+		prim.texcoords.bl.v = prim.texcoords.br.v = flipped ? 0.0f : 1.0f;
+		prim.texture.base = &texture[0];
+		prim.texture.rowpixels = texwidth;
+		prim.texture.width = texwidth;
+		prim.texture.height = texheight;
+		prim.texture.palette = nullptr;
+		prim.texture.dirtyminy = 1;
+		prim.texture.dirtymaxy = 0;
+		renderer::draw_primitive(prim, &before[0], width, height, width, 0, height - 1);
+
+		for (int iter = 0; iter < 500; iter++)
+		{
+			// change a few rows of the texture, then redraw the frame in full
+			// and just the rows the texture change maps to over the old one
+			INT32 first = rand() % texheight;
+			INT32 last = first + rand() % 6;
+			last = MIN(last, INT32(texheight) - 1);
+			for (INT32 y = first; y <= last; y++)
+				for (UINT32 x = 0; x < texwidth; x++)
+					texture[y * texwidth + x] = rand() & 0xffffff;
+			prim.texture.dirtyminy = first;
+			prim.texture.dirtymaxy = last;
+
+			INT32 miny = INT32(height), maxy = -1;
+			render_texture_dirty_rows(prim, miny, maxy);
+			miny = MAX(miny, 0);
+			maxy = MIN(maxy, INT32(height) - 1);
+
+			renderer::draw_primitive(prim, &full[0], width, height, width, 0, height - 1);
+			partial = before;
+			renderer::draw_primitive(prim, &partial[0], width, height, width, miny, maxy);
+			ASSERT_TRUE(partial == full)
+					<< "iteration " << iter << ", texture rows " << first << "-" << last
+					<< ", target rows " << miny << "-" << maxy;
+			ASSERT_LT(maxy - miny + 1, INT32(height) / 2) << "iteration " << iter;
+
+			before = full;
+		}
+	}
+}
+
+TEST(rendersw,dirty_band_bilinear)
+{
+	typedef software_renderer<UINT32, 0,0,0, 16,8,0, false, true> renderer;
+	const UINT32 texwidth = 64, texheight = 48, width = 160, height = 123;
+
+	// a screen-sized RGB32 texture scaled onto a target that isn't a whole
+	// multiple of it, with a band of rows changed between two frames
+	for (bool flipped : { false, true })
+	{
+		std::mt19937 rand(3 + flipped);
+		std::vector<UINT32> texture(texwidth * texheight);
+		std::vector<UINT32> before(width * height), full(width * height), partial(width * height);
+		render_primitive prim;
+
+		for (UINT32 &texel : texture)
+			texel = rand() & 0xffffff;
+
+		prim.type = render_primitive::QUAD;
+		prim.flags = PRIMFLAG_TEXFORMAT(TEXFORMAT_RGB32) | PRIMFLAG_BLENDMODE(BLENDMODE_NONE);
+		set_render_bounds_xy(&prim.bounds, 0.0f, 0.0f, float(width), float(height));
+		set_render_color(&prim.color, 1.0f, 1.0f, 1.0f, 1.0f);
+		prim.texcoords.tl.u = prim.texcoords.bl.u = 0.0f;
+		prim.texcoords.tr.u = prim.texcoords.br.u = 1.0f;
+		prim.texcoords.tl.v = prim.texcoords.tr.v = flipped ? 1.0f : 0.0f;
+		prim.texcoords.bl.v = prim.texcoords.br.v = flipped ? 0.0f : 1.0f;
+		prim.texture.base = &texture[0];
+		prim.texture.rowpixels = texwidth;
+		prim.texture.width = texwidth;
+		prim.texture.height = texheight;
+		prim.texture.palette = nullptr;
+		prim.texture.dirtyminy = 1;
+		prim.texture.dirtymaxy = 0;
+		renderer::draw_primitive(prim, &before[0], width, height, width, 0, height - 1);
+
+		for (int iter = 0; iter < 500; iter++)
+		{
+			// change a few rows of the texture, then redraw the frame in full
+			// and just the rows the texture change maps to over the old one
+			INT32 first = rand() % texheight;
+			INT32 last = first + rand() % 6;
+			last = MIN(last, INT32(texheight) - 1);
+			for (INT32 y = first; y <= last; y++)
+				for (UINT32 x = 0; x < texwidth; x++)
+					texture[y * texwidth + x] = rand() & 0xffffff;
+			prim.texture.dirtyminy = first;
+			prim.texture.dirtymaxy = last;
+
+			INT32 miny = INT32(height), maxy = -1;
+			render_texture_dirty_rows(prim, miny, maxy);
+			miny = MAX(miny, 0);
+			maxy = MIN(maxy, INT32(height) - 1);
+
+			renderer::draw_primitive(prim, &full[0], width, height, width, 0, height - 1);
+			partial = before;
+			renderer::draw_primitive(prim, &partial[0], width, height, width, miny, maxy);
+			ASSERT_TRUE(partial == full)
+					<< "iteration " << iter << ", texture rows " << first << "-" << last
+					<< ", target rows " << miny << "-" << maxy;
+			ASSERT_LT(maxy - miny + 1, INT32(height) / 2) << "iteration " << iter;
+
+			before = full;
+		}
+	}
+}
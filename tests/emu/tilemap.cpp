@@ -0,0 +1,63 @@
+#include "gtest/gtest.h"
+#include "emu.h"
+
+static const UINT8 gfx_pens[2][64] = { { 0 } };
+
+TEST(tilemap,recolor_unchanged)
+{
+	const tilemap_t::tile_source old = { gfx_pens[0], nullptr, 0x100, 0, 0, 0, 0xff, true };
+	const tilemap_t::tile_source source = old;
+	EXPECT_EQ(tilemap_t::RECOLOR_NONE, tilemap_t::tile_recolor(old, source));
+}
+
+TEST(tilemap,recolor_rebase)
+{
+	const tilemap_t::tile_source old = { gfx_pens[0], nullptr, 0x100, 0, 0, 0, 0xff, true };
+	tilemap_t::tile_source source = old;
+
+	// moving the palette base either way is the same as rendering with it
+	for (pen_t base : { 0x180, 0x010, 0xfff0 })
+	{
+		source.palette_base = base;
+		ASSERT_EQ(tilemap_t::RECOLOR_REBASE, tilemap_t::tile_recolor(old, source));
+
+		const UINT16 delta = source.palette_base - old.palette_base;
+		for (UINT32 pen = 0; pen < 256; pen++)
+		{
+			UINT16 pixel = pen + old.palette_base;
+			pixel += delta;
+			EXPECT_EQ(UINT16(pen + source.palette_base), pixel);
+		}
+	}
+}
+
+TEST(tilemap,recolor_render)
+{
+	const tilemap_t::tile_source old = { gfx_pens[0], nullptr, 0x100, 0, 0, 0, 0xff, true };
+	tilemap_t::tile_source source = old;
+
+	source.pen_data = gfx_pens[1];
+	source.palette_base = 0x200;
+	EXPECT_EQ(tilemap_t::RECOLOR_RENDER, tilemap_t::tile_recolor(old, source));
+
+	source = old;
+	source.flags = TILE_FLIPX;
+	EXPECT_EQ(tilemap_t::RECOLOR_RENDER, tilemap_t::tile_recolor(old, source));
+
+	source = old;
+	source.group = 1;
+	EXPECT_EQ(tilemap_t::RECOLOR_RENDER, tilemap_t::tile_recolor(old, source));
+}
+
+// pen data a driver decodes into its own buffer can change under the same
+// pointer, so it is never rebased, even with nothing else different
+TEST(tilemap,recolor_scratch_pen_data)
+{
+	static UINT8 scratch[64];
+	const tilemap_t::tile_source old = { scratch, nullptr, 0x100, 0, 0, 0, 0xff, false };
+	tilemap_t::tile_source source = old;
+	EXPECT_EQ(tilemap_t::RECOLOR_RENDER, tilemap_t::tile_recolor(old, source));
+
+	source.palette_base = 0x180;
+	EXPECT_EQ(tilemap_t::RECOLOR_RENDER, tilemap_t::tile_recolor(old, source));
+}
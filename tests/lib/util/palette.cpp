@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+#include "palette.h"
+
+#include <random>
+
+TEST(palette,adjusted_colors)
+{
+	palette_t *palette = palette_t::alloc(256, 3);
+	std::mt19937 rand(1);
+
+	// the float formula palette_t uses for adjusted colors, with no gamma
+	auto adjust = [](rgb_t entry, float brightness, float contrast)
+	{
+		return rgb_t(entry.a(),
+				rgb_t::clamp(float(entry.r()) * contrast + brightness),
+				rgb_t::clamp(float(entry.g()) * contrast + brightness),
+				rgb_t::clamp(float(entry.b()) * contrast + brightness));
+	};
+
+	for (int index = 0; index < 256; index++)
+		palette->entry_set_color(index, rgb_t(rand()));
+
+	// no adjustments: adjusted colors are the raw ones in every group
+	for (int index = 0; index < 256 * 3; index++)
+		EXPECT_EQ(palette->entry_color(index % 256), palette->entry_adjusted_color(index));
+
+	// shadow and hilight style groups go through the float formula
+	palette->group_set_contrast(1, 0.6f);
+	palette->group_set_contrast(2, 1.5f);
+	for (int index = 0; index < 256; index++)
+	{
+		rgb_t entry = palette->entry_color(index);
+		EXPECT_EQ(entry, palette->entry_adjusted_color(index));
+		EXPECT_EQ(adjust(entry, 0.0f, 0.6f), palette->entry_adjusted_color(256 + index));
+		EXPECT_EQ(adjust(entry, 0.0f, 1.5f), palette->entry_adjusted_color(512 + index));
+	}
+
+	// brightness alone, then back to neutral
+	palette->group_set_brightness(0, 0.5f);
+	for (int index = 0; index < 256; index++)
+		EXPECT_EQ(adjust(palette->entry_color(index), -128.0f, 1.0f), palette->entry_adjusted_color(index));
+	palette->group_set_brightness(0, 1.0f);
+	for (int index = 0; index < 256; index++)
+		EXPECT_EQ(palette->entry_color(index), palette->entry_adjusted_color(index));
+
+	palette->deref();
+}
+
+TEST(palette,dirty_entries)
+{
+	palette_t *palette = palette_t::alloc(1024, 2);
+	palette_client *client = new palette_client(*palette);
+	UINT32 mindirty, maxdirty;
+
+	// number of dirty entries the client sees, and the range they span
+	auto dirty_count = [client, &mindirty, &maxdirty]()
+	{
+		const UINT32 *dirty = client->dirty_list(mindirty, maxdirty);
+		UINT32 count = 0;
+		if (dirty != nullptr)
+			for (UINT32 index = mindirty; index <= maxdirty; index++)
+				if (dirty[index / 32] & (1 << (index % 32)))
+					count++;
+		return count;
+	};
+
+	// a new client starts with everything dirty
+	EXPECT_EQ(2048U, dirty_count());
+	EXPECT_EQ(0U, dirty_count());
+
+	// a changed entry dirties itself in every group
+	palette->entry_set_color(5, rgb_t(0x10, 0x20, 0x30));
+	EXPECT_EQ(2U, dirty_count());
+	EXPECT_EQ(5U, mindirty);
+	EXPECT_EQ(1024U + 5, maxdirty);
+
+	// rewriting the same color dirties nothing
+	palette->entry_set_color(5, rgb_t(0x10, 0x20, 0x30));
+	EXPECT_EQ(0U, dirty_count());
+
+	// far apart writes dirty only themselves, whatever the span
+	palette->entry_set_color(1, rgb_t(0x01, 0x02, 0x03));
+	palette->entry_set_color(1000, rgb_t(0x04, 0x05, 0x06));
+	EXPECT_EQ(4U, dirty_count());
+
+	// a group adjustment dirties that group only
+	palette->entry_set_color(7, rgb_t(0x80, 0x80, 0x80));
+	dirty_count();
+	palette->group_set_contrast(1, 0.5f);
+	EXPECT_EQ(4U, dirty_count());
+	EXPECT_LE(1024U, mindirty);
+
+	delete client;
+	palette->deref();
+}
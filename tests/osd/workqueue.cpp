@@ -0,0 +1,224 @@
+#include "gtest/gtest.h"
+#include "osdcore.h"
+#include "osdsync.h"
+
+#include <atomic>
+#include <vector>
+
+namespace {
+
+struct counted_item
+{
+	std::atomic<int> *  total;
+	std::atomic<int> *  running;
+	std::atomic<int> *  maxrunning;
+	std::atomic<int>    runs;
+	int                 threadid;
+};
+
+void *count_callback(void *param, int threadid)
+{
+	counted_item &item = *reinterpret_cast<counted_item *>(param);
+	int running = ++*item.running;
+	int seen = *item.maxrunning;
+	while (running > seen && !item.maxrunning->compare_exchange_weak(seen, running)) { }
+
+	// a little work so that items overlap
+	volatile int spin = 0;
+	for (int i = 0; i < 2000; i++)
+		spin = spin + i;
+
+	item.runs++;
+	item.threadid = threadid;
+	++*item.total;
+	--*item.running;
+	return param;
+}
+
+// queue count items on a queue and wait for them; returns the largest
+// number that ran at once
+int run_items(osd_work_queue *queue, std::vector<counted_item> &items)
+{
+	std::atomic<int> total(0), running(0), maxrunning(0);
+	for (counted_item &item : items)
+	{
+		item.total = &total;
+		item.running = &running;
+		item.maxrunning = &maxrunning;
+		item.runs = 0;
+		item.threadid = -1;
+	}
+	osd_work_item_queue_multiple(queue, count_callback, items.size(), &items[0], sizeof(items[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	EXPECT_TRUE(osd_work_queue_wait(queue, osd_ticks_per_second() * 10));
+	EXPECT_EQ((int)items.size(), total.load());
+	return maxrunning;
+}
+
+}
+
+TEST(workqueue,multi_runs_every_item_once)
+{
+	osd_work_queue *queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	ASSERT_TRUE(queue != nullptr);
+	std::vector<counted_item> items(1000);
+	for (int pass = 0; pass < 10; pass++)
+	{
+		run_items(queue, items);
+		for (const counted_item &item : items)
+		{
+			EXPECT_EQ(1, item.runs.load());
+			EXPECT_GE(item.threadid, 0);
+			EXPECT_LT(item.threadid, WORK_MAX_THREADS);
+		}
+	}
+	osd_work_queue_free(queue);
+}
+
+TEST(workqueue,single_queue_runs_one_at_a_time)
+{
+	// a busy multi queue must not let a plain queue run more than one item at once
+	osd_work_queue *multi = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	osd_work_queue *single = osd_work_queue_alloc(0);
+	std::vector<counted_item> multiitems(2000), singleitems(200);
+	std::atomic<int> total(0), running(0), maxrunning(0);
+	for (counted_item &item : multiitems)
+	{
+		item.total = &total;
+		item.running = &running;
+		item.maxrunning = &maxrunning;
+	}
+	osd_work_item_queue_multiple(multi, count_callback, multiitems.size(), &multiitems[0], sizeof(multiitems[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	EXPECT_LE(run_items(single, singleitems), 1);
+	EXPECT_TRUE(osd_work_queue_wait(multi, osd_ticks_per_second() * 10));
+	EXPECT_EQ((int)multiitems.size(), total.load());
+	osd_work_queue_free(single);
+	osd_work_queue_free(multi);
+}
+
+TEST(workqueue,item_wait_and_result)
+{
+	osd_work_queue *queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	std::atomic<int> total(0), running(0), maxrunning(0);
+	counted_item item;
+	item.total = &total;
+	item.running = &running;
+	item.maxrunning = &maxrunning;
+	item.runs = 0;
+	osd_work_item *work = osd_work_item_queue(queue, count_callback, &item, 0);
+	ASSERT_TRUE(work != nullptr);
+	EXPECT_TRUE(osd_work_item_wait(work, osd_ticks_per_second() * 10));
+	EXPECT_EQ(&item, osd_work_item_result(work));
+	EXPECT_EQ(1, item.runs.load());
+	osd_work_item_release(work);
+	osd_work_queue_free(queue);
+}
+
+TEST(workqueue,free_with_pending_items)
+{
+	// freeing a queue must not wait for or run its remaining items
+	osd_work_queue *queue = osd_work_queue_alloc(0);
+	std::vector<counted_item> items(5000);
+	std::atomic<int> total(0), running(0), maxrunning(0);
+	for (counted_item &item : items)
+	{
+		item.total = &total;
+		item.running = &running;
+		item.maxrunning = &maxrunning;
+	}
+	osd_work_item_queue_multiple(queue, count_callback, items.size(), &items[0], sizeof(items[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_free(queue);
+	EXPECT_LE(total.load(), (int)items.size());
+}
+
+TEST(workqueue,policy_budgets)
+{
+	// the policy applies to the pool made for the next queue allocated
+	osd_work_policy policy = { OSD_WORK_POLICY_AUTO, OSD_WORK_POLICY_AUTO, 2, 0, OSD_WORK_POLICY_AUTO };
+	osd_work_set_policy(policy);
+	osd_work_queue *render = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	osd_work_queue *audio = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ | WORK_QUEUE_FLAG_AUDIO);
+	std::vector<counted_item> items(2000);
+
+	// two pool threads plus the caller helping out
+	EXPECT_LE(run_items(render, items), 3);
+
+	// no budget: items run on the caller as they are queued
+	EXPECT_EQ(1, run_items(audio, items));
+	for (const counted_item &item : items)
+		EXPECT_EQ(0, item.threadid);
+
+	osd_work_queue_free(audio);
+	osd_work_queue_free(render);
+	policy = { OSD_WORK_POLICY_AUTO, OSD_WORK_POLICY_AUTO, OSD_WORK_POLICY_AUTO, OSD_WORK_POLICY_AUTO, OSD_WORK_POLICY_AUTO };
+	osd_work_set_policy(policy);
+}
+
+// not a pass/fail test: reports how long it takes from queueing an item
+// until it starts running, and the round trip for a batch of items
+TEST(workqueue,dispatch_latency)
+{
+	struct stamp_item
+	{
+		osd_ticks_t queued;
+		osd_ticks_t started;
+	};
+	osd_work_callback stamp = [](void *param, int threadid) -> void *
+	{
+		stamp_item &item = *reinterpret_cast<stamp_item *>(param);
+		item.started = osd_ticks();
+		return nullptr;
+	};
+
+	osd_work_queue *queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	const int passes = 2000;
+	const double tickus = 1000000.0 / (double)osd_ticks_per_second();
+
+	// single items
+	double dispatch = 0, roundtrip = 0;
+	for (int pass = 0; pass < passes; pass++)
+	{
+		stamp_item item;
+		item.queued = osd_ticks();
+		osd_work_item_queue(queue, stamp, &item, WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(queue, osd_ticks_per_second() * 10);
+		osd_ticks_t done = osd_ticks();
+		dispatch += (double)(item.started - item.queued);
+		roundtrip += (double)(done - item.queued);
+	}
+	printf("single item: dispatch %.2f us, round trip %.2f us\n", dispatch * tickus / passes, roundtrip * tickus / passes);
+
+	// single items on a plain queue, where the caller doesn't help
+	osd_work_queue *plain = osd_work_queue_alloc(0);
+	dispatch = roundtrip = 0;
+	for (int pass = 0; pass < passes; pass++)
+	{
+		stamp_item item;
+		item.queued = osd_ticks();
+		osd_work_item_queue(plain, stamp, &item, WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(plain, osd_ticks_per_second() * 10);
+		osd_ticks_t done = osd_ticks();
+		dispatch += (double)(item.started - item.queued);
+		roundtrip += (double)(done - item.queued);
+	}
+	printf("single item, plain queue: dispatch %.2f us, round trip %.2f us\n", dispatch * tickus / passes, roundtrip * tickus / passes);
+	osd_work_queue_free(plain);
+
+	// batches of 64 items
+	stamp_item batch[64];
+	dispatch = roundtrip = 0;
+	for (int pass = 0; pass < passes / 10; pass++)
+	{
+		osd_ticks_t queued = osd_ticks();
+		for (stamp_item &item : batch)
+			item.queued = queued;
+		osd_work_item_queue_multiple(queue, stamp, ARRAY_LENGTH(batch), batch, sizeof(batch[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(queue, osd_ticks_per_second() * 10);
+		osd_ticks_t done = osd_ticks();
+		for (stamp_item &item : batch)
+			dispatch += (double)(item.started - item.queued) / ARRAY_LENGTH(batch);
+		roundtrip += (double)(done - queued);
+	}
+	printf("64 item batch: mean dispatch %.2f us, round trip %.2f us\n", dispatch * tickus / (passes / 10), roundtrip * tickus / (passes / 10));
+
+	osd_work_queue_free(queue);
+}